@@ -0,0 +1,75 @@
+#ifndef EZY_BENCHMARKS_BENCHMARK_H_INCLUDED
+#define EZY_BENCHMARKS_BENCHMARK_H_INCLUDED
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+/**
+ * Minimal benchmark helpers. Build with optimizations (eg. `-DCMAKE_BUILD_TYPE=Release`), otherwise the numbers
+ * are meaningless.
+ */
+namespace bench
+{
+  template <typename T>
+  inline void do_not_optimize(const T& value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  inline void clobber_memory()
+  {
+    asm volatile("" : : : "memory");
+  }
+
+  /**
+   * Runs `fn` `iterations` times and returns the average time of one run in microseconds. The best of a few
+   * repetitions is taken to reduce noise.
+   */
+  template <typename Fn>
+  double measure(int iterations, Fn&& fn)
+  {
+    using clock = std::chrono::steady_clock;
+    double best = 0;
+    for (int repetition = 0; repetition < 5; ++repetition)
+    {
+      const auto start = clock::now();
+      for (int i = 0; i < iterations; ++i)
+      {
+        do_not_optimize(fn());
+        clobber_memory();
+      }
+      const auto elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count() / iterations;
+      if (repetition == 0 || elapsed < best)
+        best = elapsed;
+    }
+    return best;
+  }
+
+  /**
+   * Prints the average time of one run of `fn`.
+   */
+  template <typename Fn>
+  double run(std::string_view name, int iterations, Fn&& fn)
+  {
+    const double best = measure(iterations, std::forward<Fn>(fn));
+    std::printf("%-48.*s %12.3f us\n", static_cast<int>(name.size()), name.data(), best);
+    return best;
+  }
+
+  /**
+   * Prints the average time of one run of `fn` and the throughput of processing `bytes` in a run.
+   */
+  template <typename Fn>
+  double run_throughput(std::string_view name, int iterations, std::size_t bytes, Fn&& fn)
+  {
+    const double best = measure(iterations, std::forward<Fn>(fn));
+    std::printf("%-48.*s %12.3f us %10.1f MB/s\n", static_cast<int>(name.size()), name.data(), best,
+        static_cast<double>(bytes) / best);
+    return best;
+  }
+}
+
+#endif
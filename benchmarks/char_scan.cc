@@ -0,0 +1,63 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/split.h>
+
+#include <string>
+
+namespace
+{
+  std::string make_input(size_t token_length, char delimiter)
+  {
+    std::string result;
+    while (result.size() < 16 * 1024 * 1024)
+    {
+      result.append(token_length, 'x');
+      result += delimiter;
+    }
+    return result;
+  }
+
+  template <typename Delimiter>
+  size_t scalar_split(const std::string& in, const Delimiter& is_delimiter)
+  {
+    size_t total = 0;
+    auto it = in.begin();
+    while (it != in.end())
+    {
+      while (it != in.end() && is_delimiter(*it))
+        ++it;
+      const auto first = it;
+      while (it != in.end() && !is_delimiter(*it))
+        ++it;
+      total += static_cast<size_t>(it - first);
+    }
+    return total;
+  }
+
+  template <typename Delimiter>
+  size_t ezy_split(const std::string& in, const Delimiter& delimiter)
+  {
+    size_t total = 0;
+    for (const auto& part : ezy::split(in, delimiter))
+      total += part.size();
+    return total;
+  }
+}
+
+int main()
+{
+  const auto is_space = [](char c) { return c == ' '; };
+  const auto is_whitespace = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+  const ezy::char_set whitespaces(" \t\r\n");
+
+  for (const size_t token_length : {4u, 16u, 256u})
+  {
+    const auto in = make_input(token_length, ' ');
+    const auto suffix = std::to_string(token_length) + " byte tokens";
+
+    bench::run_throughput("scalar, ' ', " + suffix, 5, in.size(), [&] { return scalar_split(in, is_space); });
+    bench::run_throughput("ezy::split, ' ', " + suffix, 5, in.size(), [&] { return ezy_split(in, ' '); });
+    bench::run_throughput("scalar, \" \\t\\r\\n\", " + suffix, 5, in.size(), [&] { return scalar_split(in, is_whitespace); });
+    bench::run_throughput("ezy::split, char_set, " + suffix, 5, in.size(), [&] { return ezy_split(in, whitespaces); });
+  }
+}
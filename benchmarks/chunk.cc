@@ -0,0 +1,56 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/chunk.h>
+#include <ezy/algorithm/transform.h>
+#include <ezy/identity.h>
+
+#include <vector>
+
+namespace
+{
+  template <typename Chunks>
+  float sum_of_maxima(const Chunks& chunks)
+  {
+    float result = 0;
+    for (const auto& chunk : chunks)
+    {
+      float maximum = 0;
+      for (const float f : chunk)
+        maximum = f > maximum ? f : maximum;
+      result += maximum;
+    }
+    return result;
+  }
+
+  template <size_t N>
+  void run(const std::vector<float>& samples)
+  {
+    const auto suffix = std::to_string(N) + " element blocks";
+    bench::run("manual loop, " + suffix, 20, [&] {
+        float result = 0;
+        for (size_t i = 0; i + N <= samples.size(); i += N)
+        {
+          float maximum = 0;
+          for (size_t j = 0; j < N; ++j)
+            maximum = samples[i + j] > maximum ? samples[i + j] : maximum;
+          result += maximum;
+        }
+        return result;
+    });
+    bench::run("ezy::chunk of a view, " + suffix, 20, [&] {
+        return sum_of_maxima(ezy::chunk(ezy::transform(samples, ezy::identity), N));
+    });
+    bench::run("ezy::chunk, " + suffix, 20, [&] { return sum_of_maxima(ezy::chunk(samples, N)); });
+    bench::run("ezy::chunk<N>, " + suffix, 20, [&] { return sum_of_maxima(ezy::chunk<N>(samples)); });
+  }
+}
+
+int main()
+{
+  std::vector<float> samples(1 << 20);
+  for (size_t i = 0; i < samples.size(); ++i)
+    samples[i] = static_cast<float>((i * 7919) % 1000);
+
+  run<64>(samples);
+  run<256>(samples);
+}
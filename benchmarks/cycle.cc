@@ -0,0 +1,44 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/collect.h>
+#include <ezy/algorithm/cycle.h>
+#include <ezy/algorithm/repeat.h>
+#include <ezy/algorithm/take.h>
+
+#include <list>
+#include <vector>
+
+int main()
+{
+  constexpr size_t n = 1 << 20;
+  const std::vector<int> lanes{1, 2, 3, 4, 5, 6, 7};
+  const std::list<int> lane_list(lanes.begin(), lanes.end());
+
+  bench::run("round robin: take(cycle(list))", 50, [&] {
+      return ezy::collect<std::vector<int>>(ezy::take(ezy::cycle(lane_list), n)).back();
+  });
+
+  bench::run("round robin: take(cycle(vector))", 50, [&] {
+      return ezy::collect<std::vector<int>>(ezy::take(ezy::cycle(lanes), n)).back();
+  });
+
+  bench::run("round robin: cycle(vector)[i]", 50, [&] {
+      const auto cycled = ezy::cycle(lanes);
+      long sum = 0;
+      for (size_t i = 0; i < n; i += 97)
+        sum += cycled[i * 1031];
+      return sum;
+  });
+
+  bench::run("padding: vector(n, 0)", 50, [&] {
+      return std::vector<char>(n, '\0').size();
+  });
+
+  bench::run("padding: take(repeat(0))", 50, [&] {
+      return ezy::collect<std::vector<char>>(ezy::take(ezy::repeat('\0'), n)).size();
+  });
+
+  bench::run("padding: repeat(0, n)", 50, [&] {
+      return ezy::collect<std::vector<char>>(ezy::repeat('\0', n)).size();
+  });
+}
@@ -0,0 +1,72 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/features/iterable.h>
+#include <ezy/strong_type.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+/**
+ * A 6 stage pipeline (map, filter, map, filter, map, take) is expected to run as fast as the hand-written
+ * loop when it is consumed by internal iteration (accumulate, collect, etc.).
+ */
+int main()
+{
+  std::vector<std::int64_t> v(1 << 22);
+  std::iota(v.begin(), v.end(), 0);
+  const size_t limit = v.size() / 3;
+
+  const auto scale = [](std::int64_t i) { return i * 3; };
+  const auto is_odd = [](std::int64_t i) { return (i & 1) != 0; };
+  const auto offset = [](std::int64_t i) { return i + 7; };
+  const auto not_multiple_of_5 = [](std::int64_t i) { return i % 5 != 0; };
+  const auto square = [](std::int64_t i) { return i * i; };
+
+  const auto hand_written = [&] {
+      std::int64_t sum = 0;
+      size_t taken = 0;
+      for (const std::int64_t e : v)
+      {
+        const std::int64_t scaled = scale(e);
+        if (!is_odd(scaled))
+          continue;
+        const std::int64_t offsetted = offset(scaled);
+        if (!not_multiple_of_5(offsetted))
+          continue;
+        sum += square(offsetted);
+        if (++taken == limit)
+          break;
+      }
+      return sum;
+  };
+
+  const auto pipeline = ezy::make_extended<ezy::features::iterable>(v)
+    .map(scale)
+    .filter(is_odd)
+    .map(offset)
+    .filter(not_multiple_of_5)
+    .map(square)
+    .take(limit);
+
+  if (hand_written() != pipeline.accumulate(std::int64_t{0}))
+  {
+    std::printf("results differ\n");
+    return 1;
+  }
+
+  bench::run("hand-written loop", 20, hand_written);
+
+  bench::run("algo_iterable pipeline: accumulate", 20, [&] {
+      return pipeline.accumulate(std::int64_t{0});
+  });
+
+  bench::run("algo_iterable pipeline: range-for", 20, [&] {
+      std::int64_t sum = 0;
+      for (const std::int64_t e : pipeline)
+        sum += e;
+      return sum;
+  });
+}
@@ -0,0 +1,51 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/concatenate.h>
+#include <ezy/algorithm/flatten.h>
+
+#include <numeric>
+#include <vector>
+
+int main()
+{
+  std::vector<std::vector<long>> nested(1'000, std::vector<long>(1'000));
+  for (auto& v : nested)
+    std::iota(v.begin(), v.end(), 0);
+
+  bench::run("flatten: hand-written nested loop", 20, [&] {
+      long sum = 0;
+      for (const auto& v : nested)
+        for (long i : v)
+          sum += i;
+      return sum;
+  });
+
+  const auto flattened = ezy::flatten(nested);
+
+  bench::run("flatten: iterators", 20, [&] {
+      return std::accumulate(flattened.begin(), flattened.end(), 0L);
+  });
+
+  bench::run("flatten: ezy::accumulate", 20, [&] {
+      return ezy::accumulate(flattened, 0L);
+  });
+
+  const auto concatenated = ezy::concatenate(nested[0], nested[1], nested[2], nested[3], nested[4], nested[5], nested[6], nested[7]);
+
+  bench::run("concatenate: hand-written loops", 200, [&] {
+      long sum = 0;
+      for (size_t n = 0; n < 8; ++n)
+        for (long i : nested[n])
+          sum += i;
+      return sum;
+  });
+
+  bench::run("concatenate: iterators", 200, [&] {
+      return std::accumulate(concatenated.begin(), concatenated.end(), 0L);
+  });
+
+  bench::run("concatenate: ezy::accumulate", 200, [&] {
+      return ezy::accumulate(concatenated, 0L);
+  });
+}
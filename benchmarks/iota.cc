@@ -0,0 +1,39 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/iterate.h>
+#include <ezy/algorithm/range.h>
+#include <ezy/algorithm/take.h>
+
+#include <vector>
+
+/**
+ * Loops over ezy::range are expected to compile to the same code as the counted loop: compare the
+ * disassembly of `counted_loop` and `range_loop` (eg. `objdump -d --no-show-raw-insn benchmark_iota`).
+ */
+__attribute__((noinline)) void counted_loop(float* out, int n)
+{
+  for (int i = 0; i < n; ++i)
+    out[i] = static_cast<float>(i) * 0.5f;
+}
+
+__attribute__((noinline)) void range_loop(float* out, int n)
+{
+  for (const int i : ezy::range(n))
+    out[i] = static_cast<float>(i) * 0.5f;
+}
+
+__attribute__((noinline)) void take_while_iterate_loop(float* out, int n)
+{
+  for (const int i : ezy::take_while(ezy::iterate(0), [n](int e) { return e < n; }))
+    out[i] = static_cast<float>(i) * 0.5f;
+}
+
+int main()
+{
+  constexpr int n = 1 << 20;
+  std::vector<float> out(n);
+
+  bench::run("counted for loop", 100, [&] { counted_loop(out.data(), n); return out[n - 1]; });
+  bench::run("ezy::range", 100, [&] { range_loop(out.data(), n); return out[n - 1]; });
+  bench::run("take_while(iterate(0), < n)", 100, [&] { take_while_iterate_loop(out.data(), n); return out[n - 1]; });
+}
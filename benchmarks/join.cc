@@ -0,0 +1,33 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/join.h>
+
+#include <string>
+#include <vector>
+
+int main()
+{
+  std::vector<std::string> words;
+  for (size_t i = 0; i < 100'000; ++i)
+    words.push_back(std::to_string(i * 7919));
+
+  bench::run("join: append by element", 50, [&] {
+      std::string result;
+      bool first = true;
+      for (const auto& word : words)
+      {
+        if (!first)
+          result += ", ";
+        first = false;
+        result += word;
+      }
+      return result.size();
+  });
+  bench::run("join: ezy::join", 50, [&] { return ezy::join(words, ", ").size(); });
+
+  std::string buffer;
+  bench::run("join: ezy::join_append into a reused buffer", 50, [&] {
+      buffer.clear();
+      return ezy::join_append(buffer, words, ", ").size();
+  });
+}
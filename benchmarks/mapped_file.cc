@@ -0,0 +1,44 @@
+#include "benchmark.h"
+
+#include <ezy/mapped_file.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+/**
+ * Usage: benchmark_mapped_file [size in MB, default: 2048] [path, default: /tmp/ezy_benchmark_mapped_file]
+ */
+int main(int argc, char* argv[])
+{
+  const size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2048;
+  const std::string path = argc > 2 ? argv[2] : "/tmp/ezy_benchmark_mapped_file";
+
+  {
+    std::ofstream out(path, std::ios::binary);
+    std::string block;
+    for (size_t i = 0; block.size() < 1024 * 1024; ++i)
+      block += "2024-01-01T00:00:00 INFO request " + std::to_string(i * 7919) + " served in " + std::to_string(i % 997) + "ms\n";
+    for (size_t i = 0; i < megabytes; ++i)
+      out << block;
+  }
+  const size_t bytes = ezy::mapped_file(path).size();
+
+  bench::run_throughput("std::getline", 1, bytes, [&] {
+      std::ifstream in(path, std::ios::binary);
+      std::string line;
+      size_t total = 0;
+      while (std::getline(in, line))
+        total += line.size();
+      return total;
+  });
+  bench::run_throughput("ezy::mapped_file::lines", 1, bytes, [&] {
+      size_t total = 0;
+      for (const auto line : ezy::mapped_file(path).lines())
+        total += line.size();
+      return total;
+  });
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,63 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/cache_latest.h>
+#include <ezy/algorithm/filter.h>
+#include <ezy/algorithm/memoize_all.h>
+#include <ezy/algorithm/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+  /**
+   * Stands for an expensive transformation, eg. decompression.
+   */
+  __attribute__((noinline)) std::uint64_t expensive(std::uint64_t seed)
+  {
+    bench::clobber_memory(); // not to be merged with a call on the same element
+    std::uint64_t x = seed + 1;
+    for (int i = 0; i < 200; ++i)
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return x >> 40;
+  }
+}
+
+int main()
+{
+  std::vector<std::uint64_t> v(1 << 14);
+  std::iota(v.begin(), v.end(), 0);
+
+  bench::run("max_element(transform)", 20, [&] {
+      const auto transformed = ezy::transform(v, expensive);
+      return *std::max_element(transformed.begin(), transformed.end());
+  });
+
+  bench::run("max_element(memoize_all(transform))", 20, [&] {
+      const auto memoized = ezy::memoize_all(ezy::transform(v, expensive));
+      return *std::max_element(memoized.begin(), memoized.end());
+  });
+
+  const auto is_small = [](std::uint64_t x) { return x < (1ULL << 23); };
+
+  bench::run("range-for over filter(transform)", 20, [&] {
+      std::uint64_t sum = 0;
+      for (const std::uint64_t x : ezy::filter(ezy::transform(v, expensive), is_small))
+        sum += x;
+      return sum;
+  });
+
+  bench::run("range-for over filter(cache_latest(transform))", 20, [&] {
+      std::uint64_t sum = 0;
+      for (const std::uint64_t x : ezy::filter(ezy::cache_latest(ezy::transform(v, expensive)), is_small))
+        sum += x;
+      return sum;
+  });
+
+  const auto memoized = ezy::memoize_all(ezy::transform(v, expensive));
+  bench::run("second pass over memoize_all", 20, [&] {
+      return std::accumulate(memoized.begin(), memoized.end(), std::uint64_t{0});
+  });
+}
@@ -0,0 +1,24 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/filter.h>
+#include <ezy/algorithm/parallel.h>
+#include <ezy/algorithm/transform.h>
+
+#include <numeric>
+#include <vector>
+
+int main()
+{
+  std::vector<long> v(10'000'000);
+  std::iota(v.begin(), v.end(), 0);
+
+  const auto chain = ezy::filter(
+      ezy::transform(v, [](long i) { return i * 3 + 1; }),
+      [](long i) { return i % 7 != 0; });
+
+  bench::run("map().filter().accumulate(): sequential", 10, [&] { return ezy::accumulate(chain, 0L); });
+  bench::run("map().filter().accumulate(): ezy::par", 10, [&] { return ezy::accumulate(ezy::par, chain, 0L); });
+
+  bench::run("any_of (match in the middle): sequential", 10, [&] { return ezy::any_of(v, [](long i) { return i == 5'000'000; }); });
+  bench::run("any_of (match in the middle): ezy::par", 10, [&] { return ezy::any_of(ezy::par, v, [](long i) { return i == 5'000'000; }); });
+}
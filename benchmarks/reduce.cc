@@ -0,0 +1,45 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/count_if.h>
+#include <ezy/algorithm/min_element.h>
+#include <ezy/algorithm/minmax.h>
+#include <ezy/algorithm/reduce.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+int main()
+{
+  std::vector<float> floats(1'000'000);
+  std::vector<std::int64_t> ints(1'000'000);
+  for (size_t i = 0; i < floats.size(); ++i)
+  {
+    floats[i] = static_cast<float>((i * 7919) % 1000) / 10.f;
+    ints[i] = static_cast<std::int64_t>((i * 7919) % 100'000);
+  }
+
+  bench::run("float sum: ezy::accumulate", 50, [&] { return ezy::accumulate(floats, 0.f); });
+  bench::run("float sum: ezy::reduce(reassociate)", 50, [&] { return ezy::reduce(floats, 0.f, ezy::reassociate); });
+
+  bench::run("int64 sum: ezy::accumulate", 50, [&] { return ezy::accumulate(ints, std::int64_t{0}); });
+  bench::run("int64 sum: ezy::reduce(reassociate)", 50, [&] { return ezy::reduce(ints, std::int64_t{0}, ezy::reassociate); });
+
+  bench::run("float min: std::min_element", 50, [&] { return *std::min_element(floats.begin(), floats.end()); });
+  bench::run("float min: ezy::min_element", 50, [&] { return *ezy::min_element(floats); });
+
+  bench::run("int64 minmax: std::minmax_element", 50, [&] {
+      const auto result = std::minmax_element(ints.begin(), ints.end());
+      return *result.second - *result.first;
+  });
+  bench::run("int64 minmax: ezy::minmax", 50, [&] {
+      const auto result = ezy::minmax(ints);
+      return result->second - result->first;
+  });
+
+  const auto is_small = [](float f) { return f < 10.f; };
+  bench::run("float count_if: std::count_if", 50, [&] { return std::count_if(floats.begin(), floats.end(), is_small); });
+  bench::run("float count_if: ezy::count_if", 50, [&] { return ezy::count_if(floats, is_small); });
+}
@@ -0,0 +1,48 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/rolling.h>
+#include <ezy/algorithm/windows.h>
+#include <ezy/algorithm/accumulate.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  template <typename Range>
+  double sum_of(const Range& range)
+  {
+    double result = 0;
+    for (const auto& e : range)
+      result += e;
+    return result;
+  }
+}
+
+int main()
+{
+  std::vector<double> series(1'000'000);
+  for (size_t i = 0; i < series.size(); ++i)
+    series[i] = static_cast<double>((i * 7919) % 1000);
+
+  constexpr size_t window_size = 60;
+
+  bench::run("moving sum: accumulate every window", 5, [&] {
+      double result = 0;
+      for (const auto& window : ezy::windows(series, window_size))
+        result += ezy::accumulate(window, 0.);
+      return result;
+  });
+  bench::run("moving sum: ezy::rolling", 5, [&] { return sum_of(ezy::rolling(series, window_size, std::plus<>{})); });
+
+  bench::run("moving min: min_element of every window", 5, [&] {
+      double result = 0;
+      for (const auto& window : ezy::windows(series, window_size))
+        result += *std::min_element(window.begin(), window.end());
+      return result;
+  });
+  bench::run("moving min: ezy::rolling", 5, [&] { return sum_of(ezy::rolling(series, window_size, ezy::min)); });
+
+  const auto maximum = [](double a, double b) { return a > b ? a : b; };
+  bench::run("moving max (two stacks): ezy::rolling", 5, [&] { return sum_of(ezy::rolling(series, window_size, maximum)); });
+}
@@ -0,0 +1,43 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/chunk.h>
+#include <ezy/algorithm/drop.h>
+#include <ezy/algorithm/step.h>
+#include <ezy/algorithm/take.h>
+
+#include <cstdio>
+#include <list>
+#include <numeric>
+#include <vector>
+
+template <typename Range>
+void report_size(const char* name, const Range& range)
+{
+  std::printf("%-48s iterator: %3zu bytes, sentinel: %zu byte\n",
+      name, sizeof(range.end()), sizeof(range.sentinel()));
+}
+
+int main()
+{
+  std::vector<long> v(1'000'000);
+  std::iota(v.begin(), v.end(), 0);
+
+  const auto pipeline = ezy::take_while(
+      ezy::drop(ezy::step_by(v, 3), 10),
+      [](long i) { return i < 2'900'000; });
+
+  const std::list<long> l(v.begin(), v.begin() + 1000);
+  report_size("step_by(list)", ezy::step_by(l, 3));
+  report_size("drop(step_by(list))", ezy::drop(ezy::step_by(l, 3), 10));
+  report_size("take_while(drop(step_by(vector)))", pipeline);
+  report_size("chunk(vector)", ezy::chunk(v, 16));
+
+  bench::run("take_while(drop(step_by)): end iterator", 20, [&] {
+      return std::accumulate(pipeline.begin(), pipeline.end(), 0L);
+  });
+
+  bench::run("take_while(drop(step_by)): sentinel", 20, [&] {
+      return ezy::accumulate(pipeline, 0L);
+  });
+}
@@ -0,0 +1,35 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/slice.h>
+
+#include <list>
+#include <numeric>
+#include <vector>
+
+int main()
+{
+  constexpr size_t size = 1'000'000;
+  std::vector<long> v(size);
+  std::iota(v.begin(), v.end(), 0);
+  const std::list<long> l(v.begin(), v.end());
+
+  bench::run("pointer arithmetic", 100, [&] {
+      const long* first = v.data() + 1000 + 100 + 10;
+      const long* last = first + 1000;
+      return std::accumulate(first, last, 0L);
+  });
+
+  bench::run("slice(slice(slice(vector)))", 100, [&] {
+      const auto sliced = ezy::slice(ezy::slice(ezy::slice(v, 1000, size - 1000), 100, 10000), 10, 1010);
+      return ezy::accumulate(sliced, 0L);
+  });
+
+  bench::run("slice(list) at the front", 100, [&] {
+      return ezy::accumulate(ezy::slice(l, 10, 1010), 0L);
+  });
+
+  bench::run("slice(slice(list)) at the front", 100, [&] {
+      return ezy::accumulate(ezy::slice(ezy::slice(l, 100, 10000), 10, 1010), 0L);
+  });
+}
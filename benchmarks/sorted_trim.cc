@@ -0,0 +1,37 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/drop.h>
+#include <ezy/algorithm/take.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+struct before
+{
+  bool operator()(std::int64_t t) const
+  { return t < limit; }
+
+  std::int64_t limit;
+};
+
+int main()
+{
+  std::vector<std::int64_t> timestamps(10'000'000);
+  std::iota(timestamps.begin(), timestamps.end(), 0);
+  const std::int64_t from = 9'000'000;
+  const std::int64_t until = 9'000'100;
+
+  bench::run("trim: take_while(drop_while)", 20, [&] {
+      return ezy::accumulate(ezy::take_while(ezy::drop_while(timestamps, before{from}), before{until}), std::int64_t{0});
+  });
+
+  bench::run("trim: take_while_sorted(drop_while_sorted)", 20, [&] {
+      return ezy::accumulate(ezy::take_while_sorted(ezy::drop_while_sorted(timestamps, before{from}), before{until}), std::int64_t{0});
+  });
+
+  bench::run("drop(vector, 9M)", 20, [&] {
+      return *ezy::drop(timestamps, 9'000'000).begin();
+  });
+}
@@ -0,0 +1,31 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/split.h>
+
+#include <string>
+
+int main()
+{
+  std::string log;
+  for (size_t i = 0; log.size() < 16 * 1024 * 1024; ++i)
+    log += "2024-01-01T00:00:00 INFO request " + std::to_string(i * 7919) + " served in " + std::to_string(i % 997) + "ms\n";
+
+  bench::run_throughput("split by ' ': owned tokens", 5, log.size(), [&] {
+      size_t total = 0;
+      for (const auto& part : ezy::split(log, ' '))
+        total += std::string(part).size();
+      return total;
+  });
+  bench::run_throughput("split by ' ': string_view tokens", 5, log.size(), [&] {
+      size_t total = 0;
+      for (const auto& part : ezy::split(log, ' '))
+        total += part.size();
+      return total;
+  });
+  bench::run_throughput("split by '\\n': string_view tokens", 5, log.size(), [&] {
+      size_t total = 0;
+      for (const auto& line : ezy::split(log, '\n'))
+        total += line.size();
+      return total;
+  });
+}
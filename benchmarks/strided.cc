@@ -0,0 +1,44 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/step.h>
+
+#include <list>
+#include <vector>
+
+int main()
+{
+  constexpr size_t rows = 1 << 12;
+  constexpr size_t columns = 256;
+  std::vector<int> matrix(rows * columns);
+  for (size_t i = 0; i < matrix.size(); ++i)
+    matrix[i] = static_cast<int>(i % 1000);
+
+  bench::run("column sum, raw loop", 200, [&] {
+    long sum = 0;
+    for (size_t r = 0; r < rows; ++r)
+      sum += matrix[r * columns + 7];
+    return sum;
+  });
+
+  bench::run("column sum, ezy::strided", 200, [&] {
+    long sum = 0;
+    for (const int e : ezy::strided(matrix.data() + 7, columns, rows))
+      sum += e;
+    return sum;
+  });
+
+  bench::run("column sum, step_by(vector)", 200, [&] {
+    long sum = 0;
+    for (const int e : ezy::step_by(matrix, columns))
+      sum += e;
+    return sum;
+  });
+
+  std::list<int> list(matrix.begin(), matrix.end());
+  bench::run("column sum, step_by(list)", 20, [&] {
+    long sum = 0;
+    for (const int e : ezy::step_by(list, columns))
+      sum += e;
+    return sum;
+  });
+}
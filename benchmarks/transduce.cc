@@ -0,0 +1,42 @@
+#include "benchmark.h"
+
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/filter.h>
+#include <ezy/algorithm/take.h>
+#include <ezy/algorithm/transform.h>
+#include <ezy/transducer.h>
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+int main()
+{
+  std::vector<std::int64_t> v(1 << 22);
+  std::iota(v.begin(), v.end(), 0);
+  const size_t limit = v.size() / 4;
+
+  const auto scale = [](std::int64_t i) { return i * 3; };
+  const auto is_odd = [](std::int64_t i) { return (i & 1) != 0; };
+
+  bench::run("view pipeline: accumulate", 20, [&] {
+      return ezy::accumulate(ezy::take(ezy::filter(ezy::transform(v, scale), is_odd), limit), std::int64_t{0});
+  });
+
+  const auto xf = ezy::pipe(ezy::xf::map(scale), ezy::xf::filter(is_odd), ezy::xf::take(limit));
+
+  bench::run("transduce", 20, [&] {
+      return ezy::transduce(v, xf, std::plus<>{}, std::int64_t{0});
+  });
+
+  bench::run("transducer sink, pushed element by element", 20, [&] {
+      auto sink = ezy::make_transducer_sink<std::int64_t>(xf, std::plus<>{}, std::int64_t{0});
+      for (const std::int64_t e : v)
+      {
+        if (!sink(e))
+          break;
+      }
+      return std::move(sink).complete();
+  });
+}
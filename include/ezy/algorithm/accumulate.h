@@ -2,7 +2,9 @@
 #define EZY_ALGORITHM_ACCUMULATE_H_INCLUDED
 
 #include <ezy/invoke.h>
+#include <ezy/bits/internal_iteration.h>
 #include <iterator>
+#include <type_traits>
 
 namespace ezy
 {
@@ -31,19 +33,25 @@ namespace ezy
   }
 
   template <typename Range, typename Init>
-  constexpr Init accumulate(Range&& range, Init&& init)
+  constexpr std::decay_t<Init> accumulate(Range&& range, Init&& init)
   {
-    using std::begin;
-    using std::end;
-    return detail::accumulate(begin(range), end(range), std::forward<Init>(init));
+    std::decay_t<Init> result(std::forward<Init>(init));
+    detail::for_each_until(range, [&](auto&& element) {
+        result = std::move(result) + element;
+        return true;
+    });
+    return result;
   }
 
   template <typename Range, typename Init, typename BinaryOp>
-  constexpr Init accumulate(Range&& range, Init&& init, BinaryOp&& op)
+  constexpr std::decay_t<Init> accumulate(Range&& range, Init&& init, BinaryOp&& op)
   {
-    using std::begin;
-    using std::end;
-    return detail::accumulate(begin(range), end(range), std::forward<Init>(init), std::forward<BinaryOp>(op));
+    std::decay_t<Init> result(std::forward<Init>(init));
+    detail::for_each_until(range, [&](auto&& element) {
+        result = ezy::invoke(op, std::move(result), std::forward<decltype(element)>(element));
+        return true;
+    });
+    return result;
   }
 }
 
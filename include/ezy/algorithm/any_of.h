@@ -1,14 +1,16 @@
 #ifndef EZY_ALGORITHM_ANY_OF_H_INCLUDED
 #define EZY_ALGORITHM_ANY_OF_H_INCLUDED
 
-#include <algorithm>
+#include <ezy/bits/internal_iteration.h>
 
 namespace ezy
 {
   template <typename Range, typename Predicate>
   constexpr bool any_of(Range&& range, Predicate&& predicate)
   {
-    return std::any_of(std::begin(range), std::end(range), std::forward<Predicate>(predicate));
+    return !detail::for_each_until(range, [&](auto&& element) -> bool {
+        return !predicate(std::forward<decltype(element)>(element));
+    });
   }
 }
 
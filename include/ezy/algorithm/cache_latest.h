@@ -0,0 +1,22 @@
+#ifndef EZY_ALGORITHM_CACHE_LATEST_H_INCLUDED
+#define EZY_ALGORITHM_CACHE_LATEST_H_INCLUDED
+
+#include <ezy/range.h>
+
+namespace ezy
+{
+  /**
+   * The same elements, but the current element is evaluated only once, however many times it is dereferenced,
+   * eg. `ezy::filter(ezy::cache_latest(ezy::transform(files, decompress)), is_valid)`. The result is a single
+   * pass range, which can be iterated only as mutable (as std::views::cache_latest). Use memoize_all for
+   * algorithms revisiting elements (eg. std::max_element).
+   */
+  template <typename Range>
+  auto cache_latest(Range&& range)
+  {
+    using ResultRange = detail::cache_latest_view<experimental::detail::deduce_keeper_t<Range>>;
+    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range))};
+  }
+}
+
+#endif
@@ -3,13 +3,44 @@
 
 #include <ezy/range.h>
 
+#include <cassert>
+
 namespace ezy
 {
+  /**
+   * Splits the range into parts of `chunk_size` (> 0) elements, the last one may be shorter. Chunks of
+   * contiguous ranges are span_views.
+   */
   template <typename Range>
   constexpr auto chunk(Range&& range, size_t chunk_size)
   {
-    using ResultRange = detail::chunk_range_view<experimental::detail::deduce_keeper_t<Range>>;
-    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), chunk_size};
+    assert(chunk_size > 0);
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    if constexpr (detail::is_contiguous_range_v<std::remove_reference_t<Range>>)
+    {
+      using ResultRange = detail::contiguous_chunk_range_view<Keeper>;
+      return ResultRange(ezy::experimental::make_keeper(std::forward<Range>(range)), chunk_size);
+    }
+    else
+    {
+      using ResultRange = detail::chunk_range_view<Keeper>;
+      return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), chunk_size};
+    }
+  }
+
+  /**
+   * Splits a contiguous range into span_views of `N` elements. Elements after the last full chunk are not
+   * visited, they are available by `remainder()`.
+   */
+  template <size_t N, typename Range>
+  constexpr auto chunk(Range&& range)
+  {
+    static_assert(N > 0, "Chunk size must be positive");
+    static_assert(detail::is_contiguous_range_v<std::remove_reference_t<Range>>,
+        "Chunks of static size are available only for contiguous ranges");
+
+    using ResultRange = detail::contiguous_chunk_range_view<experimental::detail::deduce_keeper_t<Range>, N>;
+    return ResultRange(ezy::experimental::make_keeper(std::forward<Range>(range)), N);
   }
 }
 
@@ -2,17 +2,92 @@
 #define EZY_ALGORITHM_COLLECT_H_INCLUDED
 
 #include <ezy/type_traits.h>
+#include <ezy/bits/internal_iteration.h>
+#include <ezy/bits/size_hint.h>
 
 #include <array> // for std::[c]begin|end
+#include <cstddef>
+#include <utility>
 
 namespace ezy
 {
+  namespace detail
+  {
+    template <typename Container, typename = void>
+    struct has_reserve : std::false_type {};
+
+    template <typename Container>
+    struct has_reserve<Container, void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>> : std::true_type {};
+
+    template <typename Container, typename Element, typename = void>
+    struct has_emplace_back : std::false_type {};
+
+    template <typename Container, typename Element>
+    struct has_emplace_back<Container, Element, void_t<decltype(std::declval<Container&>().emplace_back(std::declval<Element>()))>>
+      : std::true_type {};
+
+    template <typename Container, typename Element, typename = void>
+    struct has_push_back : std::false_type {};
+
+    template <typename Container, typename Element>
+    struct has_push_back<Container, Element, void_t<decltype(std::declval<Container&>().push_back(std::declval<Element>()))>>
+      : std::true_type {};
+
+    /**
+     * Containers with reserve() are filled element by element after reserving the lower bound of the size
+     * hint, unless the iterators of the range are random access: then the iterator pair constructor can
+     * allocate exactly.
+     */
+    template <typename Result, typename Range>
+    constexpr bool collect_by_reserving_v = has_reserve<Result>::value
+      && (has_emplace_back<Result, decltype(*std::cbegin(std::declval<Range&>()))>::value
+          || has_push_back<Result, decltype(*std::cbegin(std::declval<Range&>()))>::value)
+      && !does_range_iterator_implement_v<const Range, std::random_access_iterator_tag>;
+
+    /**
+     * Upper bounds of inexact size hints (eg. of filter) are reserved only up to this many bytes.
+     */
+    constexpr std::size_t speculative_reserve_bytes = 64 * 1024;
+
+    /**
+     * Ranges of copies of the same value (eg. ezy::repeat(value, n)) provide it by `fill_value()`.
+     */
+    template <typename Result, typename Range, typename = void>
+    struct collect_by_filling : std::false_type {};
+
+    template <typename Result, typename Range>
+    struct collect_by_filling<Result, Range, void_t<decltype(std::declval<const Range&>().fill_value())>>
+      : std::bool_constant<std::is_constructible_v<Result, typename Range::size_type, decltype(std::declval<const Range&>().fill_value())>>
+    {};
+  }
+
   template <typename Result, typename Range>
   constexpr auto collect(Range&& range)
   {
     using std::cbegin;
     using std::cend;
-    return Result(cbegin(range), cend(range));
+    if constexpr (detail::collect_by_filling<Result, ezy::remove_cvref_t<Range>>::value)
+    {
+      return Result(range.size(), range.fill_value());
+    }
+    else if constexpr (detail::collect_by_reserving_v<Result, ezy::remove_cvref_t<Range>>)
+    {
+      Result result;
+      constexpr std::size_t reserve_limit = detail::speculative_reserve_bytes / sizeof(typename Result::value_type);
+      result.reserve(detail::reserve_hint(detail::size_hint(range), reserve_limit));
+      detail::for_each_until(std::as_const(range), [&result](auto&& element) {
+          if constexpr (detail::has_emplace_back<Result, decltype(element)>::value)
+            result.emplace_back(std::forward<decltype(element)>(element));
+          else
+            result.push_back(std::forward<decltype(element)>(element));
+          return true;
+      });
+      return result;
+    }
+    else
+    {
+      return Result(cbegin(range), cend(range));
+    }
   }
 
   template <template <typename, typename ...> class ResultWrapper, typename Range>
@@ -26,10 +101,10 @@ namespace ezy
   template <typename Range, typename OutputIter>
   OutputIter collect(Range&& range, OutputIter out)
   {
-    for (auto&& e : range)
-    {
-      *out++ = e;
-    }
+    detail::for_each_until(range, [&](auto&& e) {
+        *out++ = e;
+        return true;
+    });
     return out;
   }
 }
@@ -5,17 +5,15 @@
 
 namespace ezy
 {
-  template <typename Range1, typename Range2>
-  /*constexpr*/ auto concatenate(Range1&& range1, Range2&& range2)
+  template <typename... Ranges>
+  /*constexpr*/ auto concatenate(Ranges&&... ranges)
   {
     using ResultRangeType = detail::concatenated_range_view<
-      experimental::detail::deduce_keeper_t<Range1>,
-      experimental::detail::deduce_keeper_t<Range2>
+      experimental::detail::deduce_keeper_t<Ranges>...
       >;
 
     return ResultRangeType{
-      ezy::experimental::make_keeper(std::forward<Range1>(range1)),
-      ezy::experimental::make_keeper(std::forward<Range2>(range2))
+      ezy::experimental::make_keeper(std::forward<Ranges>(ranges))...
     };
   }
 }
@@ -0,0 +1,34 @@
+#ifndef EZY_ALGORITHM_COUNT_IF_H_INCLUDED
+#define EZY_ALGORITHM_COUNT_IF_H_INCLUDED
+
+#include <ezy/bits/internal_iteration.h>
+#include <ezy/bits/range_utils.h>
+
+#include <cstddef>
+
+namespace ezy
+{
+  template <typename Range, typename Predicate>
+  constexpr std::size_t count_if(Range&& range, Predicate&& pred)
+  {
+    std::size_t count = 0;
+    if constexpr (detail::is_contiguous_range_v<Range>)
+    {
+      // branchless loop over the raw array, which can be vectorized
+      auto first = std::data(range);
+      const auto last = first + ezy::size(range);
+      for (; first != last; ++first)
+        count += pred(*first) ? 1 : 0;
+    }
+    else
+    {
+      detail::for_each_until(range, [&](auto&& element) {
+          count += pred(std::forward<decltype(element)>(element)) ? 1 : 0;
+          return true;
+      });
+    }
+    return count;
+  }
+}
+
+#endif
@@ -5,12 +5,28 @@
 
 namespace ezy
 {
+  /**
+   * Repeats the elements of the range infinitely. Over sized random access ranges it is random access, so
+   * `ezy::take(ezy::cycle(range), n)` is sized and can be indexed.
+   */
   template <typename Range>
   constexpr auto cycle(Range&& range)
   {
-    return detail::cycle_view<experimental::detail::deduce_keeper_t<Range>>{
-      ezy::experimental::make_keeper(std::forward<Range>(range))
-    };
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    using BareRange = std::remove_reference_t<Range>;
+    if constexpr (detail::is_sized_range_v<BareRange>
+        && detail::does_range_iterator_implement_v<BareRange, std::random_access_iterator_tag>)
+    {
+      return detail::random_access_cycle_view<Keeper>{
+        ezy::experimental::make_keeper(std::forward<Range>(range))
+      };
+    }
+    else
+    {
+      return detail::cycle_view<Keeper>{
+        ezy::experimental::make_keeper(std::forward<Range>(range))
+      };
+    }
   }
 }
 
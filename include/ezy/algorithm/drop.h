@@ -5,13 +5,30 @@
 
 namespace ezy
 {
+  /**
+   * The range without its first `n` elements. Over sized random access ranges the first element is reached in
+   * constant time, and the result is random access too.
+   */
   template <typename Range>
   constexpr auto drop(Range&& range, detail::size_type_t<Range> n)
   {
-    using ResultRangeType = detail::drop_range_view<experimental::detail::deduce_keeper_t<Range>>;
-    return ResultRangeType{
-      ezy::experimental::make_keeper(std::forward<Range>(range)), n
-    };
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    using BareRange = std::remove_reference_t<Range>;
+    if constexpr (detail::is_sized_range_v<BareRange>
+        && detail::does_range_iterator_implement_v<BareRange, std::random_access_iterator_tag>)
+    {
+      using ResultRangeType = detail::random_access_drop_range_view<Keeper>;
+      return ResultRangeType{
+        ezy::experimental::make_keeper(std::forward<Range>(range)), n
+      };
+    }
+    else
+    {
+      using ResultRangeType = detail::drop_range_view<Keeper>;
+      return ResultRangeType{
+        ezy::experimental::make_keeper(std::forward<Range>(range)), n
+      };
+    }
   }
 
   template <typename Range, typename Predicate>
@@ -23,6 +40,21 @@ namespace ezy
       std::forward<Predicate>(pred)
     };
   }
+
+  /**
+   * drop_while for monotonic predicates (true for a prefix of the range, then false), eg. trimming a sorted
+   * range: `ezy::drop_while_sorted(timestamps, [from](auto t) { return t < from; })`. The first kept element
+   * is found by binary search.
+   */
+  template <typename Range, typename Predicate>
+  constexpr auto drop_while_sorted(Range&& range, Predicate&& pred)
+  {
+    using ResultRangeType = detail::partitioned_range_view<experimental::detail::deduce_keeper_t<Range>, ezy::remove_cvref_t<Predicate>, false>;
+    return ResultRangeType{
+      ezy::experimental::make_keeper(std::forward<Range>(range)),
+      std::forward<Predicate>(pred)
+    };
+  }
 }
 
 #endif
@@ -2,6 +2,7 @@
 #define EZY_ALGORITHM_ENUMERATE_H_INCLUDED
 
 #include <ezy/algorithm/iterate.h>
+#include <ezy/algorithm/range.h>
 #include <ezy/algorithm/zip.h>
 #include <ezy/range.h> // detail::size_type
 
@@ -9,13 +10,23 @@ namespace ezy
 {
   /**
    * When multiple ranges passed, they has to have the same size_type.
+   *
+   * Indices of sized ranges are a sized, random access view, so the enumerated range keeps its size.
    */
   template <typename Range0, typename... Ranges>
   constexpr auto enumerate(Range0&& range0, Ranges&&... ranges)
   {
     using SizeType = detail::size_type_t<Range0>;
     static_assert(std::conjunction_v<std::is_same<SizeType, detail::size_type_t<Ranges>>...>);
-    return ezy::zip(ezy::iterate<SizeType>({}), std::forward<Range0>(range0), std::forward<Ranges>(ranges)...);
+    if constexpr (detail::is_sized_range_v<std::remove_reference_t<Range0>>)
+    {
+      const auto size = static_cast<SizeType>(ezy::size(range0));
+      return ezy::zip(ezy::range(size), std::forward<Range0>(range0), std::forward<Ranges>(ranges)...);
+    }
+    else
+    {
+      return ezy::zip(ezy::iterate<SizeType>({}), std::forward<Range0>(range0), std::forward<Ranges>(ranges)...);
+    }
   }
 }
 
@@ -5,14 +5,34 @@
 
 namespace ezy
 {
+  namespace detail
+  {
+    template <typename Range>
+    struct is_filtered_range : std::false_type {};
+
+    template <typename Keeper, typename FilterPredicate>
+    struct is_filtered_range<range_view_filter<Keeper, FilterPredicate>> : std::true_type {};
+  }
+
+  /**
+   * Filtering a temporary filtered range (eg. `v.filter(p).filter(q)`) does not nest the views: the result is
+   * a single view checking both predicates.
+   */
   template <typename Range, typename Predicate>
   /*constexpr*/ auto filter(Range&& range, Predicate&& pred)
   {
-    using result_range_type = detail::range_view_filter<experimental::detail::deduce_keeper_t<Range>, Predicate>;
-    return result_range_type{
-      ezy::experimental::make_keeper(std::forward<Range>(range)),
-      std::forward<Predicate>(pred)
-    };
+    if constexpr (detail::is_filtered_range<Range>::value)
+    {
+      return std::move(range).and_filter(std::forward<Predicate>(pred));
+    }
+    else
+    {
+      using result_range_type = detail::range_view_filter<experimental::detail::deduce_keeper_t<Range>, Predicate>;
+      return result_range_type{
+        ezy::experimental::make_keeper(std::forward<Range>(range)),
+        std::forward<Predicate>(pred)
+      };
+    }
   }
 
 }
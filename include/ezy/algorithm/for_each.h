@@ -1,16 +1,18 @@
 #ifndef EZY_ALGORITHM_FOR_EACH_H_INCLUDED
 #define EZY_ALGORITHM_FOR_EACH_H_INCLUDED
 
-#include <algorithm>
+#include <ezy/bits/internal_iteration.h>
 
 namespace ezy
 {
   template <typename Range, typename UnaryFunction>
-  /*constexpr?*/ decltype(auto) for_each(Range&& range, UnaryFunction&& fn)
+  /*constexpr?*/ auto for_each(Range&& range, UnaryFunction&& fn)
   {
-    using std::begin;
-    using std::end;
-    return std::for_each(begin(range), end(range), std::forward<UnaryFunction>(fn));
+    detail::for_each_until(range, [&](auto&& element) {
+        fn(std::forward<decltype(element)>(element));
+        return true;
+    });
+    return std::forward<UnaryFunction>(fn);
   }
 }
 
@@ -3,42 +3,156 @@
 
 #include <ezy/empty.h>
 #include <ezy/range.h>
+#include <ezy/algorithm/collect.h> // detail::has_reserve
+#include <ezy/bits/internal_iteration.h>
+
 #include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace ezy
 {
-  template <typename ReturnType, typename Range, typename Separator = detail::value_type_t<Range>>
-  constexpr ReturnType join(Range&& range, Separator&& separator = Separator{})
+  namespace detail
   {
-    using std::begin;
-    using std::end;
-    if (ezy::empty(range))
+    template <typename Piece>
+    constexpr bool is_character_v = std::is_same_v<ezy::remove_cvref_t<Piece>, char>;
+
+    template <typename Piece>
+    constexpr bool is_string_like_v = std::is_convertible_v<const Piece&, std::string_view>;
+
+    /**
+     * Pieces of a join are measurable if their length is known without building or traversing them.
+     */
+    template <typename Piece>
+    constexpr bool is_measurable_piece_v = is_character_v<Piece> || is_string_like_v<Piece>;
+
+    template <typename Piece>
+    constexpr std::size_t piece_length(const Piece& piece)
     {
-      return ReturnType{};
+      if constexpr (is_character_v<Piece>)
+        return 1;
+      else
+        return std::string_view(piece).size();
     }
-    else
+
+    /**
+     * Returns the length of the joined string, if it can be measured in a cheap pass: the elements are
+     * stored (not computed on dereferencing) and the range can be traversed more than once.
+     */
+    template <typename Range, typename Separator>
+    constexpr std::size_t joined_length(const Range& range, const Separator& separator)
     {
-      ReturnType result{*begin(range)};
-      std::for_each(
-          std::next(begin(range)),
-          end(range),
-          [&result,separator](const auto& e)
-          {
-            result += separator;
-            result += e;
-          }
-        );
-      return result;
+      std::size_t count = 0;
+      std::size_t length = 0;
+      for (const auto& element : range)
+      {
+        length += piece_length(element);
+        ++count;
+      }
+      return count > 1 ? length + (count - 1) * piece_length(separator) : length;
     }
+
+    /**
+     * Joining non-owning strings (eg. the parts of a split) results in an owning string.
+     */
+    template <typename ValueType>
+    struct join_result
+    {
+      using type = ValueType;
+    };
+
+    template <typename CharT, typename Traits>
+    struct join_result<std::basic_string_view<CharT, Traits>>
+    {
+      using type = std::basic_string<CharT, Traits>;
+    };
+
+    template <typename ValueType>
+    using join_result_t = typename join_result<ValueType>::type;
+
+    template <typename Result, typename Range, typename Separator>
+    constexpr bool is_join_measurable_v = has_reserve<Result>::value
+      && std::is_lvalue_reference_v<decltype(*std::cbegin(std::declval<Range&>()))>
+      && is_measurable_piece_v<decltype(*std::cbegin(std::declval<Range&>()))>
+      && is_measurable_piece_v<Separator>
+      && does_range_iterator_implement_v<const Range, std::forward_iterator_tag>;
+  }
+
+  /**
+   * Appends the elements of the range to `result`, separated by `separator`, and returns `result`. When the
+   * length of the elements can be measured cheaply, the required capacity is reserved first.
+   */
+  template <typename Result, typename Range, typename Separator = detail::value_type_t<Range>>
+  constexpr Result& join_append(Result& result, Range&& range, Separator&& separator = Separator{})
+  {
+    if constexpr (detail::is_join_measurable_v<Result, ezy::remove_cvref_t<Range>, Separator>)
+    {
+      result.reserve(result.size() + detail::joined_length(range, separator));
+    }
+
+    bool first = true;
+    detail::for_each_until(range, [&result, &separator, &first](const auto& e) {
+        if (!first)
+          result += separator;
+        first = false;
+        result += e;
+        return true;
+    });
+    return result;
+  }
+
+  /**
+   * Writes the elements of the range to `out`, separated by `separator`. Elements and the separator can be
+   * characters, strings or ranges of characters.
+   */
+  template <typename Range, typename OutputIterator, typename Separator = detail::value_type_t<Range>>
+  OutputIterator join_into(Range&& range, OutputIterator out, Separator&& separator = Separator{})
+  {
+    const auto write = [&out](const auto& piece)
+    {
+      using Piece = decltype(piece);
+      if constexpr (detail::is_character_v<Piece>)
+      {
+        *out++ = piece;
+      }
+      else if constexpr (detail::is_string_like_v<Piece>)
+      {
+        const std::string_view view(piece);
+        out = std::copy(view.begin(), view.end(), out);
+      }
+      else
+      {
+        using std::begin;
+        using std::end;
+        out = std::copy(begin(piece), end(piece), out);
+      }
+    };
+
+    bool first = true;
+    detail::for_each_until(range, [&write, &separator, &first](const auto& e) {
+        if (!first)
+          write(separator);
+        first = false;
+        write(e);
+        return true;
+    });
+    return out;
+  }
+
+  template <typename ReturnType, typename Range, typename Separator = detail::value_type_t<Range>>
+  constexpr ReturnType join(Range&& range, Separator&& separator = Separator{})
+  {
+    ReturnType result{};
+    ezy::join_append(result, std::forward<Range>(range), std::forward<Separator>(separator));
+    return result;
   }
 
   template <typename Range, typename Separator = detail::value_type_t<Range>>
   constexpr auto join(Range&& range, Separator&& separator = Separator{})
   {
-    using std::begin;
-    using std::end;
-    using ValueType = detail::value_type_t<Range>;
-    return join<ValueType>(std::forward<Range>(range), std::forward<Separator>(separator));
+    using ResultType = detail::join_result_t<detail::value_type_t<Range>>;
+    return join<ResultType>(std::forward<Range>(range), std::forward<Separator>(separator));
   }
 }
 
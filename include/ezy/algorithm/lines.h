@@ -0,0 +1,19 @@
+#ifndef EZY_ALGORITHM_LINES_H_INCLUDED
+#define EZY_ALGORITHM_LINES_H_INCLUDED
+
+#include <ezy/range.h>
+
+namespace ezy
+{
+  /**
+   * Views the lines of a contiguous character range (eg. a string or a mapped_file) as string_views.
+   */
+  template <typename Range>
+  auto lines(Range&& range)
+  {
+    using ResultRange = detail::lines_view<experimental::detail::deduce_keeper_t<Range>>;
+    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range))};
+  }
+}
+
+#endif
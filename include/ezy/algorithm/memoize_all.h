@@ -0,0 +1,20 @@
+#ifndef EZY_ALGORITHM_MEMOIZE_ALL_H_INCLUDED
+#define EZY_ALGORITHM_MEMOIZE_ALL_H_INCLUDED
+
+#include <ezy/range.h>
+
+namespace ezy
+{
+  /**
+   * The same elements, each evaluated once: the first pass stores them as they are reached, later passes (and
+   * repeated dereferences) replay the stored elements.
+   */
+  template <typename Range>
+  auto memoize_all(Range&& range)
+  {
+    using ResultRange = detail::memoize_all_view<experimental::detail::deduce_keeper_t<Range>>;
+    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range))};
+  }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef EZY_ALGORITHM_MIN_ELEMENT_H_INCLUDED
+#define EZY_ALGORITHM_MIN_ELEMENT_H_INCLUDED
+
+#include <ezy/bits/fold_lanes.h>
+#include <ezy/bits/range_utils.h>
+#include <ezy/experimental/keeper.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace ezy
+{
+  namespace detail
+  {
+    template <typename Range, typename Compare>
+    constexpr auto extremum_element(Range& range, Compare compare)
+    {
+      using std::begin;
+      using std::end;
+      if constexpr (is_contiguous_arithmetic_range_v<Range>)
+      {
+        const auto first = std::data(range);
+        const auto found = extremum_element_lanes(first, first + ezy::size(range), compare);
+        return std::next(begin(range), found - first);
+      }
+      else
+      {
+        return std::min_element(begin(range), end(range), compare);
+      }
+    }
+  }
+
+  /**
+   * Returns an iterator to the first smallest element, or the end of the range if it is empty.
+   */
+  template <typename Range>
+  constexpr auto min_element(Range&& range)
+  {
+    static_assert(std::is_same_v<
+        ezy::experimental::detail::ownership_category_t<Range>,
+        ezy::experimental::reference_category_tag
+        >, "Range must be a reference! Cannot form an iterator to a temporary!");
+
+    return detail::extremum_element(range, std::less<>{});
+  }
+
+  template <typename Range, typename Compare>
+  constexpr auto min_element(Range&& range, Compare&& compare)
+  {
+    static_assert(std::is_same_v<
+        ezy::experimental::detail::ownership_category_t<Range>,
+        ezy::experimental::reference_category_tag
+        >, "Range must be a reference! Cannot form an iterator to a temporary!");
+
+    using std::begin;
+    using std::end;
+    return std::min_element(begin(range), end(range), std::forward<Compare>(compare));
+  }
+
+  /**
+   * Returns an iterator to the first largest element, or the end of the range if it is empty.
+   */
+  template <typename Range>
+  constexpr auto max_element(Range&& range)
+  {
+    static_assert(std::is_same_v<
+        ezy::experimental::detail::ownership_category_t<Range>,
+        ezy::experimental::reference_category_tag
+        >, "Range must be a reference! Cannot form an iterator to a temporary!");
+
+    return detail::extremum_element(range, std::greater<>{});
+  }
+
+  template <typename Range, typename Compare>
+  constexpr auto max_element(Range&& range, Compare&& compare)
+  {
+    static_assert(std::is_same_v<
+        ezy::experimental::detail::ownership_category_t<Range>,
+        ezy::experimental::reference_category_tag
+        >, "Range must be a reference! Cannot form an iterator to a temporary!");
+
+    using std::begin;
+    using std::end;
+    return std::max_element(begin(range), end(range), std::forward<Compare>(compare));
+  }
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef EZY_ALGORITHM_MINMAX_H_INCLUDED
+#define EZY_ALGORITHM_MINMAX_H_INCLUDED
+
+#include <ezy/optional.h>
+#include <ezy/bits/fold_lanes.h>
+#include <ezy/bits/internal_iteration.h>
+#include <ezy/bits/range_utils.h>
+
+#include <utility>
+
+namespace ezy
+{
+  /**
+   * Returns the smallest and the largest element of the range, or an empty optional if the range is empty.
+   */
+  template <typename Range>
+  constexpr auto minmax(Range&& range)
+  {
+    using value_type = detail::value_type_t<Range>;
+    using ResultType = ezy::optional<std::pair<value_type, value_type>>;
+
+    if constexpr (detail::is_contiguous_arithmetic_range_v<Range>)
+    {
+      const auto first = std::data(range);
+      const auto last = first + ezy::size(range);
+      if (first == last)
+        return ResultType{};
+
+      return ResultType(detail::minmax_lanes(first, last));
+    }
+    else
+    {
+      std::optional<std::pair<value_type, value_type>> result;
+      detail::for_each_until(range, [&result](const auto& element) {
+          if (!result)
+            result.emplace(element, element);
+          else if (element < result->first)
+            result->first = element;
+          else if (result->second < element)
+            result->second = element;
+          return true;
+      });
+
+      if (!result)
+        return ResultType{};
+
+      return ResultType(std::move(*result));
+    }
+  }
+}
+
+#endif
@@ -1,14 +1,14 @@
 #ifndef EZY_ALGORITHM_NONE_OF_H_INCLUDED
 #define EZY_ALGORITHM_NONE_OF_H_INCLUDED
 
-#include <algorithm>
+#include <ezy/algorithm/any_of.h>
 
 namespace ezy
 {
   template <typename Range, typename Predicate>
   constexpr bool none_of(Range&& range, Predicate&& predicate)
   {
-    return std::none_of(std::begin(range), std::end(range), std::forward<Predicate>(predicate));
+    return !ezy::any_of(std::forward<Range>(range), std::forward<Predicate>(predicate));
   }
 }
 
@@ -0,0 +1,276 @@
+#ifndef EZY_ALGORITHM_PARALLEL_H_INCLUDED
+#define EZY_ALGORITHM_PARALLEL_H_INCLUDED
+
+#include <ezy/execution.h>
+#include <ezy/algorithm/accumulate.h>
+#include <ezy/algorithm/all_of.h>
+#include <ezy/algorithm/any_of.h>
+#include <ezy/algorithm/collect.h>
+#include <ezy/algorithm/contains.h>
+#include <ezy/algorithm/find_element.h>
+#include <ezy/algorithm/for_each.h>
+#include <ezy/algorithm/none_of.h>
+#include <ezy/algorithm/reduce.h>
+#include <ezy/bits/partition.h>
+
+#include <atomic>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+/**
+ * Execution policy overloads of the terminal algorithms.
+ *
+ * With ezy::par or ezy::par_unseq, partitionable ranges (random access sized ranges, and transform, filter,
+ * zip and slice views over them) are processed in chunks on a shared thread pool. Other ranges, and
+ * ezy::seq are processed sequentially. As with std algorithms, the functions have to be safe to call
+ * concurrently, and reductions may regroup the operations.
+ */
+namespace ezy
+{
+  namespace detail
+  {
+    template <typename Tag, typename Range>
+    constexpr bool runs_parallel_v = is_parallel_policy_v<Tag> && is_partitionable_v<Range>;
+
+    template <typename Tag, typename Range, typename Init, typename BinaryOp>
+    std::decay_t<Init> parallel_reduce(const execution::execution_policy<Tag>& policy, Range& range, Init&& init, BinaryOp& op)
+    {
+      using Acc = std::decay_t<Init>;
+      prepare_parts(range);
+      const auto extent = partition_extent(range);
+      const auto chunk_count = chunk_count_for(policy, extent);
+      std::vector<std::optional<Acc>> partials(chunk_count);
+
+      parallel_chunks(chunk_count, extent, [&](std::size_t index, std::size_t from, std::size_t until) {
+          auto& partial = partials[index];
+          for_each_until_in(range, from, until, [&](auto&& element) {
+              if (partial)
+                partial = op(std::move(*partial), std::forward<decltype(element)>(element));
+              else
+                partial.emplace(std::forward<decltype(element)>(element));
+              return true;
+          });
+      });
+
+      Acc result(std::forward<Init>(init));
+      for (auto& partial : partials)
+      {
+        if (partial)
+          result = op(std::move(result), std::move(*partial));
+      }
+      return result;
+    }
+
+    /**
+     * Returns true if `predicate` is satisfied by any of the elements. Once a match is found, the chunks which
+     * have not been started are skipped and the running ones stop.
+     */
+    template <typename Tag, typename Range, typename Predicate>
+    bool parallel_any_of(const execution::execution_policy<Tag>& policy, Range& range, Predicate& predicate)
+    {
+      prepare_parts(range);
+      const auto extent = partition_extent(range);
+      std::atomic<bool> found{false};
+
+      parallel_chunks(chunk_count_for(policy, extent), extent, [&](std::size_t, std::size_t from, std::size_t until) {
+          if (found.load(std::memory_order_relaxed))
+            return;
+
+          for_each_until_in(range, from, until, [&](auto&& element) {
+              if (found.load(std::memory_order_relaxed))
+                return false;
+
+              if (predicate(std::forward<decltype(element)>(element)))
+              {
+                found.store(true, std::memory_order_relaxed);
+                return false;
+              }
+              return true;
+          });
+      });
+
+      return found.load();
+    }
+  }
+
+  template <typename Tag, typename Range, typename UnaryFunction>
+  auto for_each(const execution::execution_policy<Tag>& policy, Range&& range, UnaryFunction&& fn)
+  {
+    if constexpr (detail::runs_parallel_v<Tag, Range>)
+    {
+      detail::prepare_parts(range);
+      const auto extent = detail::partition_extent(range);
+      detail::parallel_chunks(detail::chunk_count_for(policy, extent), extent, [&](std::size_t, std::size_t from, std::size_t until) {
+          detail::for_each_until_in(range, from, until, [&](auto&& element) {
+              fn(std::forward<decltype(element)>(element));
+              return true;
+          });
+      });
+      return std::forward<UnaryFunction>(fn);
+    }
+    else
+    {
+      return ezy::for_each(std::forward<Range>(range), std::forward<UnaryFunction>(fn));
+    }
+  }
+
+  template <typename Tag, typename Range, typename Init, typename BinaryOp>
+  std::decay_t<Init> reduce(const execution::execution_policy<Tag>& policy, Range&& range, Init&& init, BinaryOp&& op)
+  {
+    if constexpr (detail::runs_parallel_v<Tag, Range>)
+      return detail::parallel_reduce(policy, range, std::forward<Init>(init), op);
+    else
+      return ezy::reduce(std::forward<Range>(range), std::forward<Init>(init), std::forward<BinaryOp>(op));
+  }
+
+  template <typename Tag, typename Range, typename Init>
+  std::decay_t<Init> reduce(const execution::execution_policy<Tag>& policy, Range&& range, Init&& init)
+  {
+    return ezy::reduce(policy, std::forward<Range>(range), std::forward<Init>(init), std::plus<>{});
+  }
+
+  /**
+   * Unlike the sequential version, the parallel accumulate may regroup the operations, like reduce.
+   */
+  template <typename Tag, typename Range, typename Init, typename BinaryOp>
+  std::decay_t<Init> accumulate(const execution::execution_policy<Tag>& policy, Range&& range, Init&& init, BinaryOp&& op)
+  {
+    return ezy::reduce(policy, std::forward<Range>(range), std::forward<Init>(init), std::forward<BinaryOp>(op));
+  }
+
+  template <typename Tag, typename Range, typename Init>
+  std::decay_t<Init> accumulate(const execution::execution_policy<Tag>& policy, Range&& range, Init&& init)
+  {
+    return ezy::reduce(policy, std::forward<Range>(range), std::forward<Init>(init), std::plus<>{});
+  }
+
+  template <typename Tag, typename Range, typename Predicate>
+  bool any_of(const execution::execution_policy<Tag>& policy, Range&& range, Predicate&& predicate)
+  {
+    if constexpr (detail::runs_parallel_v<Tag, Range>)
+      return detail::parallel_any_of(policy, range, predicate);
+    else
+      return ezy::any_of(std::forward<Range>(range), std::forward<Predicate>(predicate));
+  }
+
+  template <typename Tag, typename Range, typename Predicate>
+  bool all_of(const execution::execution_policy<Tag>& policy, Range&& range, Predicate&& predicate)
+  {
+    return !ezy::any_of(policy, std::forward<Range>(range), [&predicate](auto&& element) -> bool {
+        return !predicate(std::forward<decltype(element)>(element));
+    });
+  }
+
+  template <typename Tag, typename Range, typename Predicate>
+  bool none_of(const execution::execution_policy<Tag>& policy, Range&& range, Predicate&& predicate)
+  {
+    return !ezy::any_of(policy, std::forward<Range>(range), std::forward<Predicate>(predicate));
+  }
+
+  template <typename Tag, typename Range, typename Needle>
+  bool contains(const execution::execution_policy<Tag>& policy, Range&& range, Needle&& needle)
+  {
+    return ezy::any_of(policy, std::forward<Range>(range), [&needle](const auto& element) -> bool {
+        return element == needle;
+    });
+  }
+
+  /**
+   * Returns an iterator to the first element satisfying `pred`. Chunks after the one of the first match found
+   * so far are cancelled.
+   */
+  template <typename Tag, typename Range, typename Predicate>
+  auto find_element_if(const execution::execution_policy<Tag>& policy, Range&& range, Predicate&& pred)
+  {
+    static_assert(std::is_same_v<
+        ezy::experimental::detail::ownership_category_t<Range>,
+        ezy::experimental::reference_category_tag
+        >, "Range must be a reference! Cannot form an iterator to a temporary!");
+
+    constexpr bool has_random_access = detail::is_sized_range_v<Range>
+      && detail::does_range_iterator_implement_v<Range, std::random_access_iterator_tag>;
+
+    if constexpr (detail::is_parallel_policy_v<Tag> && has_random_access)
+    {
+      using std::begin;
+      using difference_type = typename std::iterator_traits<decltype(begin(range))>::difference_type;
+      const auto first = begin(range);
+      const auto extent = static_cast<std::size_t>(ezy::size(range));
+      std::atomic<std::size_t> first_match{extent};
+
+      detail::parallel_chunks(detail::chunk_count_for(policy, extent), extent, [&](std::size_t, std::size_t from, std::size_t until) {
+          auto it = std::next(first, static_cast<difference_type>(from));
+          for (auto position = from; position != until; ++position, ++it)
+          {
+            auto current_first = first_match.load(std::memory_order_relaxed);
+            if (current_first < position)
+              return;
+
+            if (pred(*it))
+            {
+              while (position < current_first && !first_match.compare_exchange_weak(current_first, position))
+              {}
+              return;
+            }
+          }
+      });
+
+      return std::next(first, static_cast<difference_type>(first_match.load()));
+    }
+    else
+    {
+      return ezy::find_element_if(std::forward<Range>(range), std::forward<Predicate>(pred));
+    }
+  }
+
+  /**
+   * The chunks are collected separately, then moved into the result in order. Results with reserve() are
+   * allocated once for all the parts.
+   */
+  template <typename Result, typename Tag, typename Range>
+  Result collect(const execution::execution_policy<Tag>& policy, Range&& range)
+  {
+    if constexpr (detail::runs_parallel_v<Tag, Range>)
+    {
+      using ValueType = detail::value_type_t<Range>;
+      detail::prepare_parts(range);
+      const auto extent = detail::partition_extent(range);
+      const auto chunk_count = detail::chunk_count_for(policy, extent);
+      std::vector<std::vector<ValueType>> parts(chunk_count);
+
+      detail::parallel_chunks(chunk_count, extent, [&](std::size_t index, std::size_t from, std::size_t until) {
+          auto& part = parts[index];
+          detail::for_each_until_in(range, from, until, [&part](auto&& element) {
+              part.emplace_back(std::forward<decltype(element)>(element));
+              return true;
+          });
+      });
+
+      Result result;
+      if constexpr (detail::has_reserve<Result>::value)
+      {
+        std::size_t size = 0;
+        for (const auto& part : parts)
+          size += part.size();
+        result.reserve(size);
+      }
+      for (auto& part : parts)
+        std::move(part.begin(), part.end(), std::inserter(result, result.end()));
+      return result;
+    }
+    else
+    {
+      return ezy::collect<Result>(std::forward<Range>(range));
+    }
+  }
+
+  template <template <typename, typename ...> class ResultWrapper, typename Tag, typename Range>
+  auto collect(const execution::execution_policy<Tag>& policy, Range&& range)
+  {
+    using ElementType = detail::value_type_t<Range>;
+    return ezy::collect<ResultWrapper<ElementType>>(policy, std::forward<Range>(range));
+  }
+}
+
+#endif
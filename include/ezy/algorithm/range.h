@@ -1,49 +1,39 @@
 #ifndef EZY_ALGORITHM_RANGE_H_INCLUDED
 #define EZY_ALGORITHM_RANGE_H_INCLUDED
 
-#include <ezy/algorithm/iterate.h>
-#include <ezy/algorithm/take.h>
+#include <ezy/range.h>
 
 namespace ezy
 {
+  /**
+   * Numbers of [0, until), one by one. The view is random access and sized, elements are computed in closed
+   * form, so a loop over it compiles to a counted loop.
+   */
   template <typename T>
   constexpr auto range(const T& until)
   {
-    return ezy::take_while(ezy::iterate(T{0}), [until](const T& e) { return e < until; });
+    using Type = ezy::remove_cvref_t<T>;
+    return detail::iota_view<Type>{Type{0}, {}, detail::steps_between(Type{0}, until, 1)};
   }
 
+  /**
+   * Numbers of [from, until), one by one.
+   */
   template <typename T>
   constexpr auto range(const T& from, const T& until)
   {
-    return ezy::take_while(ezy::iterate(from), [until](const T& e) { return e < until; });
-  }
-
-  namespace detail
-  {
-    template <typename T>
-    struct increment_by
-    {
-      explicit increment_by(const T& t)
-        : step{t}
-      {}
-
-      template <typename U>
-      auto operator()(const U& u) const
-      {
-        return u + step;
-      }
-
-      T step{};
-    };
+    using Type = ezy::remove_cvref_t<T>;
+    return detail::iota_view<Type>{from, {}, detail::steps_between(from, until, 1)};
   }
 
+  /**
+   * Numbers from `from` towards `until` (exclusive), increased by `step`, which may be negative.
+   */
   template <typename T>
   constexpr auto range(const T& from, const T& until, const T& step)
   {
     using Type = ezy::remove_cvref_t<T>;
-    const auto increment_by_step = detail::increment_by<Type>{step};
-    const auto number_of_steps = ((until - from) + (step - 1)) / step;
-    return ezy::take(ezy::iterate(from, increment_by_step), number_of_steps);
+    return detail::iota_view<Type, Type>{from, step, detail::steps_between(from, until, step)};
   }
 }
 
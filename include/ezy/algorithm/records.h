@@ -0,0 +1,22 @@
+#ifndef EZY_ALGORITHM_RECORDS_H_INCLUDED
+#define EZY_ALGORITHM_RECORDS_H_INCLUDED
+
+#include <ezy/range.h>
+
+#include <cassert>
+
+namespace ezy
+{
+  /**
+   * Views a contiguous character range as consecutive records of `record_size` (> 0) characters.
+   */
+  template <typename Range>
+  auto records(Range&& range, size_t record_size)
+  {
+    assert(record_size > 0);
+    using ResultRange = detail::records_view<experimental::detail::deduce_keeper_t<Range>>;
+    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), record_size};
+  }
+}
+
+#endif
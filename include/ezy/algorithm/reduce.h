@@ -0,0 +1,67 @@
+#ifndef EZY_ALGORITHM_REDUCE_H_INCLUDED
+#define EZY_ALGORITHM_REDUCE_H_INCLUDED
+
+#include <ezy/bits/fold_lanes.h>
+#include <ezy/bits/internal_iteration.h>
+#include <ezy/bits/range_utils.h>
+
+#include <functional>
+#include <type_traits>
+
+namespace ezy
+{
+  /**
+   * Reduction policy: the operation may be applied in any grouping and order (as std::reduce does), so the
+   * reduction of contiguous arithmetic ranges can be vectorized. The operation must be associative and
+   * commutative, for floating point numbers the result may slightly differ from the in-order one.
+   */
+  struct reassociate_t
+  {
+    explicit constexpr reassociate_t() = default;
+  };
+
+  static constexpr reassociate_t reassociate{};
+
+  /**
+   * Reduces the range from left to right, like accumulate.
+   */
+  template <typename Range, typename Init, typename BinaryOp>
+  constexpr std::decay_t<Init> reduce(Range&& range, Init&& init, BinaryOp&& op)
+  {
+    std::decay_t<Init> result(std::forward<Init>(init));
+    detail::for_each_until(range, [&](auto&& element) {
+        result = op(std::move(result), std::forward<decltype(element)>(element));
+        return true;
+    });
+    return result;
+  }
+
+  template <typename Range, typename Init>
+  constexpr std::decay_t<Init> reduce(Range&& range, Init&& init)
+  {
+    return ezy::reduce(std::forward<Range>(range), std::forward<Init>(init), std::plus<>{});
+  }
+
+  template <typename Range, typename Init, typename BinaryOp>
+  constexpr std::decay_t<Init> reduce(Range&& range, Init&& init, BinaryOp&& op, reassociate_t)
+  {
+    using Acc = std::decay_t<Init>;
+    if constexpr (detail::is_contiguous_arithmetic_range_v<Range> && std::is_arithmetic_v<Acc>)
+    {
+      const auto first = std::data(range);
+      return detail::reduce_lanes<Acc>(first, first + ezy::size(range), std::forward<Init>(init), op);
+    }
+    else
+    {
+      return ezy::reduce(std::forward<Range>(range), std::forward<Init>(init), std::forward<BinaryOp>(op));
+    }
+  }
+
+  template <typename Range, typename Init>
+  constexpr std::decay_t<Init> reduce(Range&& range, Init&& init, reassociate_t policy)
+  {
+    return ezy::reduce(std::forward<Range>(range), std::forward<Init>(init), std::plus<>{}, policy);
+  }
+}
+
+#endif
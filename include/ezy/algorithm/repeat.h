@@ -11,6 +11,16 @@ namespace ezy
     return ezy::detail::repeat_view<T>{std::forward<T>(t)};
   }
 
+  /**
+   * `n` copies of `t`: a sized random access range, eg. for padding. Collecting it into a container
+   * constructible from a count and a value, eg. `ezy::collect<std::vector<char>>(ezy::repeat('\0', 64))`, uses
+   * the fill constructor.
+   */
+  template <typename T>
+  constexpr auto repeat(T&& t, size_t n)
+  {
+    return ezy::detail::repeat_n_view<ezy::remove_cvref_t<T>>{std::forward<T>(t), n};
+  }
 }
 
 #endif
@@ -0,0 +1,50 @@
+#ifndef EZY_ALGORITHM_ROLLING_H_INCLUDED
+#define EZY_ALGORITHM_ROLLING_H_INCLUDED
+
+#include <ezy/range.h>
+#include <ezy/algorithm/transform.h>
+
+#include <type_traits>
+
+namespace ezy
+{
+  /**
+   * Marks `op` as invertible by `inverse` (`inverse(op(a, b), b) == a`), so rolling can remove the leaving
+   * element from the aggregate instead of recomputing it.
+   */
+  template <typename Op, typename Inverse>
+  constexpr auto invertible(Op op, Inverse inverse)
+  {
+    return detail::invertible_op<Op, Inverse>{std::move(op), std::move(inverse)};
+  }
+
+  /**
+   * Aggregates every window of `window_size` consecutive elements by `op` (eg. a moving sum or minimum). Each
+   * step updates the aggregate in amortized O(1):
+   *  - invertible operations (`std::plus` or `ezy::invertible(op, inverse)`) remove the leaving element,
+   *  - `ezy::min` and `ezy::max` keep a monotonic deque of candidates,
+   *  - other operations must be associative and are aggregated by two stacks.
+   *
+   * A window size of 0 gives no windows.
+   *
+   * Note: removing floating point elements accumulates rounding errors.
+   */
+  template <typename Range, typename Op>
+  auto rolling(Range&& range, size_t window_size, Op&& op)
+  {
+    using ResultRange = detail::rolling_range_view<experimental::detail::deduce_keeper_t<Range>, std::decay_t<Op>>;
+    return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), window_size, std::forward<Op>(op)};
+  }
+
+  /**
+   * Moving average of every window of `window_size` consecutive elements.
+   */
+  template <typename Range>
+  auto rolling_mean(Range&& range, size_t window_size)
+  {
+    return ezy::transform(ezy::rolling(std::forward<Range>(range), window_size, std::plus<>{}),
+        [window_size](const auto& sum) { return static_cast<double>(sum) / static_cast<double>(window_size); });
+  }
+}
+
+#endif
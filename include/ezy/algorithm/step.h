@@ -3,15 +3,42 @@
 
 #include <ezy/range.h>
 
+#include <cassert>
+#include <iterator>
+
 namespace ezy
 {
+  /**
+   * Every `n`th (> 0) element of the range, starting with the first one. Over sized random access ranges it is a
+   * random access view with O(1) steps.
+   */
   template <typename Range>
   constexpr auto step_by(Range&& range, detail::size_type_t<Range> n)
   {
-    using ResultRange = detail::step_by_range_view<experimental::detail::deduce_keeper_t<Range>>;
-    return ResultRange{
-      ezy::experimental::make_keeper(std::forward<Range>(range)), n
-    };
+    assert(n > 0);
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    using BareRange = std::remove_reference_t<Range>;
+    if constexpr (detail::is_sized_range_v<BareRange>
+        && detail::does_range_iterator_implement_v<BareRange, std::random_access_iterator_tag>)
+    {
+      using ResultRange = detail::random_access_step_by_range_view<Keeper>;
+      return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), n};
+    }
+    else
+    {
+      using ResultRange = detail::step_by_range_view<Keeper>;
+      return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), n};
+    }
+  }
+
+  /**
+   * `count` elements from `first`, every `stride`th one, without copying. Eg. the 2nd column of a row-major
+   * matrix with `columns` columns: `ezy::strided(data + 1, columns, rows)`.
+   */
+  template <typename Iterator>
+  constexpr auto strided(Iterator first, typename std::iterator_traits<Iterator>::difference_type stride, size_t count)
+  {
+    return detail::strided_view<Iterator>{first, stride, count};
   }
 }
 
@@ -5,20 +5,51 @@
 
 namespace ezy
 {
+  /**
+   * The first `n` elements of the range. Over random access ranges (including infinite ones, eg. cycle) the
+   * result is random access and sized.
+   */
   template <typename Range>
   constexpr auto take(Range&& range, detail::size_type_t<Range> n)
   {
-    using ResultRangeType = detail::take_n_range_view<experimental::detail::deduce_keeper_t<Range>>;
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    if constexpr (detail::does_range_iterator_implement_v<std::remove_reference_t<Range>, std::random_access_iterator_tag>)
+    {
+      using ResultRangeType = detail::random_access_take_range_view<Keeper>;
+      return ResultRangeType{
+        ezy::experimental::make_keeper(std::forward<Range>(range)),
+        n
+      };
+    }
+    else
+    {
+      using ResultRangeType = detail::take_n_range_view<Keeper>;
+      return ResultRangeType{
+        ezy::experimental::make_keeper(std::forward<Range>(range)),
+        n
+      };
+    }
+  }
+
+  template <typename Range, typename Predicate>
+  constexpr auto take_while(Range&& range, Predicate&& pred)
+  {
+    using ResultRangeType = detail::take_while_range_view<experimental::detail::deduce_keeper_t<Range>, ezy::remove_cvref_t<Predicate>>;
     return ResultRangeType{
       ezy::experimental::make_keeper(std::forward<Range>(range)),
-      n
+      std::forward<Predicate>(pred)
     };
   }
 
+  /**
+   * take_while for monotonic predicates (true for a prefix of the range, then false), eg. trimming a sorted
+   * range: `ezy::take_while_sorted(timestamps, [until](auto t) { return t < until; })`. The end is found by
+   * binary search.
+   */
   template <typename Range, typename Predicate>
-  constexpr auto take_while(Range&& range, Predicate&& pred)
+  constexpr auto take_while_sorted(Range&& range, Predicate&& pred)
   {
-    using ResultRangeType = detail::take_while_range_view<experimental::detail::deduce_keeper_t<Range>, ezy::remove_cvref_t<Predicate>>;
+    using ResultRangeType = detail::partitioned_range_view<experimental::detail::deduce_keeper_t<Range>, ezy::remove_cvref_t<Predicate>, true>;
     return ResultRangeType{
       ezy::experimental::make_keeper(std::forward<Range>(range)),
       std::forward<Predicate>(pred)
@@ -5,14 +5,46 @@
 
 namespace ezy
 {
+  namespace detail
+  {
+    template <typename Range, typename UnaryFunction>
+    struct is_fusable_transformation : std::false_type {};
+
+    /**
+     * The composed function is called as const (eg. by const views), so functions which can be called only as
+     * non-const (eg. mutable lambdas) are not composed.
+     */
+    template <typename Keeper, typename Transformation, typename UnaryFunction>
+    struct is_fusable_transformation<range_view<Keeper, Transformation>, UnaryFunction>
+      : std::bool_constant<
+          is_const_callable_on_v<Transformation, experimental::keeper_value_type_t<Keeper>>
+          && std::is_invocable_v<
+            const std::decay_t<UnaryFunction>&,
+            typename range_view<Keeper, Transformation>::const_iterator::result_type
+          >
+        >
+    {};
+  }
+
+  /**
+   * Transforming a temporary transformed range (eg. `v.map(f).map(g)`) does not nest the views: the result is
+   * a single view with the composed function, `ezy::pipe(f, g)`.
+   */
   template <typename Range, typename UnaryFunction>
   constexpr decltype(auto) transform(Range&& range, UnaryFunction&& fn)
   {
-    using result_range_type = detail::range_view<experimental::detail::deduce_keeper_t<Range>, UnaryFunction>;
-    return result_range_type{
-        ezy::experimental::make_keeper(std::forward<Range>(range)),
-        std::forward<UnaryFunction>(fn)
-      };
+    if constexpr (detail::is_fusable_transformation<Range, UnaryFunction>::value)
+    {
+      return std::move(range).then_transform(std::forward<UnaryFunction>(fn));
+    }
+    else
+    {
+      using result_range_type = detail::range_view<experimental::detail::deduce_keeper_t<Range>, UnaryFunction>;
+      return result_range_type{
+          ezy::experimental::make_keeper(std::forward<Range>(range)),
+          std::forward<UnaryFunction>(fn)
+        };
+    }
   }
 }
 
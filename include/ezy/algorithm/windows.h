@@ -0,0 +1,50 @@
+#ifndef EZY_ALGORITHM_WINDOWS_H_INCLUDED
+#define EZY_ALGORITHM_WINDOWS_H_INCLUDED
+
+#include <ezy/range.h>
+
+namespace ezy
+{
+  /**
+   * Overlapping windows of `window_size` consecutive elements, starting at every element. Windows of
+   * contiguous ranges are span_views, windows of forward ranges are subranges. Input ranges are read into a
+   * ring buffer, which is reused for every window. A window size of 0 gives no windows.
+   */
+  template <typename Range>
+  auto windows(Range&& range, size_t window_size)
+  {
+    using Keeper = experimental::detail::deduce_keeper_t<Range>;
+    using BareRange = std::remove_reference_t<Range>;
+    if constexpr (detail::is_contiguous_range_v<BareRange>)
+    {
+      using ResultRange = detail::contiguous_window_range_view<Keeper>;
+      return ResultRange(ezy::experimental::make_keeper(std::forward<Range>(range)), window_size);
+    }
+    else if constexpr (detail::does_range_iterator_implement_v<BareRange, std::forward_iterator_tag>)
+    {
+      using ResultRange = detail::window_range_view<Keeper>;
+      return ResultRange{ezy::experimental::make_keeper(std::forward<Range>(range)), window_size};
+    }
+    else
+    {
+      using ResultRange = detail::buffered_window_range_view<Keeper>;
+      return ResultRange(ezy::experimental::make_keeper(std::forward<Range>(range)), window_size);
+    }
+  }
+
+  /**
+   * Overlapping windows of a contiguous range as span_views of `N` elements.
+   */
+  template <size_t N, typename Range>
+  constexpr auto windows(Range&& range)
+  {
+    static_assert(N > 0, "Window size must be positive");
+    static_assert(detail::is_contiguous_range_v<std::remove_reference_t<Range>>,
+        "Windows of static size are available only for contiguous ranges");
+
+    using ResultRange = detail::contiguous_window_range_view<experimental::detail::deduce_keeper_t<Range>, N>;
+    return ResultRange(ezy::experimental::make_keeper(std::forward<Range>(range)), N);
+  }
+}
+
+#endif
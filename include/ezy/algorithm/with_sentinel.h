@@ -0,0 +1,21 @@
+#ifndef EZY_ALGORITHM_WITH_SENTINEL_H_INCLUDED
+#define EZY_ALGORITHM_WITH_SENTINEL_H_INCLUDED
+
+#include <ezy/range.h>
+
+namespace ezy
+{
+  /**
+   * Makes a view iterable with a sentinel instead of an end iterator, which is cheaper to compare with and
+   * does not need to be constructed. Useful in range-based for loops.
+   */
+  template <typename Range>
+  constexpr auto with_sentinel(Range&& range)
+  {
+    return detail::sentinel_range_view<experimental::detail::deduce_keeper_t<Range>>{
+      ezy::experimental::make_keeper(std::forward<Range>(range))
+    };
+  }
+}
+
+#endif
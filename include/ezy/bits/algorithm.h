@@ -5,11 +5,13 @@
 #include <ezy/algorithm/all_of.h>
 #include <ezy/algorithm/any_of.h>
 #include <ezy/algorithm/at.h>
+#include <ezy/algorithm/cache_latest.h>
 #include <ezy/algorithm/checked_index.h>
 #include <ezy/algorithm/chunk.h>
 #include <ezy/algorithm/collect.h>
 #include <ezy/algorithm/concatenate.h>
 #include <ezy/algorithm/contains.h>
+#include <ezy/algorithm/count_if.h>
 #include <ezy/algorithm/cycle.h>
 #include <ezy/algorithm/drop.h>
 #include <ezy/algorithm/enumerate.h>
@@ -20,15 +22,24 @@
 #include <ezy/algorithm/index.h>
 #include <ezy/algorithm/iterate.h>
 #include <ezy/algorithm/join.h>
+#include <ezy/algorithm/lines.h>
+#include <ezy/algorithm/memoize_all.h>
+#include <ezy/algorithm/min_element.h>
+#include <ezy/algorithm/minmax.h>
 #include <ezy/algorithm/none_of.h>
 #include <ezy/algorithm/range.h>
+#include <ezy/algorithm/records.h>
+#include <ezy/algorithm/reduce.h>
 #include <ezy/algorithm/repeat.h>
 #include <ezy/algorithm/reverse.h>
+#include <ezy/algorithm/rolling.h>
 #include <ezy/algorithm/slice.h>
 #include <ezy/algorithm/split.h>
 #include <ezy/algorithm/step.h>
 #include <ezy/algorithm/take.h>
 #include <ezy/algorithm/transform.h>
+#include <ezy/algorithm/windows.h>
+#include <ezy/algorithm/with_sentinel.h>
 #include <ezy/algorithm/zip.h>
 
 #endif
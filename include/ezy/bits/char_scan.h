@@ -0,0 +1,206 @@
+#ifndef EZY_BITS_CHAR_SCAN_H_INCLUDED
+#define EZY_BITS_CHAR_SCAN_H_INCLUDED
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ezy
+{
+  /**
+   * A set of single byte delimiters, eg. `ezy::split(line, ezy::char_set(" \t\r\n"))`.
+   */
+  struct char_set
+  {
+    /**
+     * Sets up to this size are scanned 16 bytes at a time, larger ones byte by byte through a lookup table.
+     */
+    static constexpr std::size_t max_vectorized_size = 8;
+
+    constexpr explicit char_set(std::string_view chars)
+    {
+      for (const char c : chars)
+      {
+        const auto index = static_cast<unsigned char>(c);
+        if (table[index])
+          continue;
+
+        table[index] = true;
+        if (count < max_vectorized_size)
+          members[count] = c;
+        ++count;
+      }
+    }
+
+    constexpr bool contains(char c) const
+    { return table[static_cast<unsigned char>(c)]; }
+
+    constexpr bool contains(unsigned char c) const
+    { return table[c]; }
+
+    constexpr bool contains(signed char c) const
+    { return table[static_cast<unsigned char>(c)]; }
+
+    constexpr bool contains(std::byte c) const
+    { return table[static_cast<unsigned char>(c)]; }
+
+    constexpr bool is_vectorizable() const
+    { return count <= max_vectorized_size; }
+
+    bool table[256]{};
+    char members[max_vectorized_size]{};
+    std::size_t count{0};
+  };
+
+namespace detail
+{
+  template <typename T>
+  constexpr bool is_byte_like_v = std::is_same_v<T, char> || std::is_same_v<T, signed char>
+    || std::is_same_v<T, unsigned char> || std::is_same_v<T, std::byte>;
+
+  /**
+   * Delimiter scanning over contiguous bytes. `find` returns the first byte matching the delimiter, `find_not`
+   * the first one not matching, or `last` if there is none.
+   *
+   * Single delimiters are searched by memchr, everything else is compared 16 bytes at a time if SSE2 is
+   * available.
+   */
+  namespace char_scan
+  {
+#if defined(__SSE2__)
+    inline int match_mask(__m128i block, char c)
+    {
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+    }
+
+    inline int match_mask(__m128i block, const char_set& set)
+    {
+      __m128i matches = _mm_setzero_si128();
+      for (std::size_t i = 0; i < set.count; ++i)
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(set.members[i])));
+      return _mm_movemask_epi8(matches);
+    }
+
+    /**
+     * Returns the first byte of [first, last) for which the match mask of its block (inverted if `Negate`) has
+     * the bit set. The tail shorter than a block is left for the caller.
+     */
+    template <bool Negate, typename Delimiter>
+    inline const char* scan_blocks(const char*& first, const char* last, const Delimiter& delimiter)
+    {
+      for (; last - first >= 16; first += 16)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        int mask = match_mask(block, delimiter);
+        if constexpr (Negate)
+          mask = ~mask & 0xffff;
+        if (mask != 0)
+          return first + __builtin_ctz(static_cast<unsigned>(mask));
+      }
+      return nullptr;
+    }
+#endif
+
+    /**
+     * Tokens are often short, so the first few bytes are checked one by one, before paying for the setup of a
+     * vectorized scan. Returns nullptr to continue scanning, so [first, last) must not be empty (the data of an
+     * empty range may be nullptr).
+     */
+    constexpr std::ptrdiff_t scalar_prefix_length = 16;
+
+    template <typename Predicate>
+    inline const char* scalar_prefix(const char*& first, const char* last, Predicate&& is_found)
+    {
+      const char* prefix_end = last - first > scalar_prefix_length ? first + scalar_prefix_length : last;
+      for (; first != prefix_end; ++first)
+      {
+        if (is_found(*first))
+          return first;
+      }
+      return first == last ? last : nullptr;
+    }
+
+    inline const char* find(const char* first, const char* last, char delimiter)
+    {
+      if (first == last)
+        return last;
+
+      if (const char* found = scalar_prefix(first, last, [delimiter](char c) { return c == delimiter; }))
+        return found;
+
+      const void* found = std::memchr(first, static_cast<unsigned char>(delimiter), static_cast<std::size_t>(last - first));
+      return found ? static_cast<const char*>(found) : last;
+    }
+
+    inline const char* find_not(const char* first, const char* last, char delimiter)
+    {
+      if (first == last)
+        return last;
+
+      if (const char* found = scalar_prefix(first, last, [delimiter](char c) { return c != delimiter; }))
+        return found;
+#if defined(__SSE2__)
+      if (const char* found = scan_blocks<true>(first, last, delimiter))
+        return found;
+#endif
+      for (; first != last; ++first)
+      {
+        if (*first != delimiter)
+          return first;
+      }
+      return last;
+    }
+
+    inline const char* find(const char* first, const char* last, const char_set& delimiters)
+    {
+      if (first == last)
+        return last;
+
+      if (const char* found = scalar_prefix(first, last, [&delimiters](char c) { return delimiters.contains(c); }))
+        return found;
+#if defined(__SSE2__)
+      if (delimiters.is_vectorizable())
+      {
+        if (const char* found = scan_blocks<false>(first, last, delimiters))
+          return found;
+      }
+#endif
+      for (; first != last; ++first)
+      {
+        if (delimiters.contains(*first))
+          return first;
+      }
+      return last;
+    }
+
+    inline const char* find_not(const char* first, const char* last, const char_set& delimiters)
+    {
+      if (first == last)
+        return last;
+
+      if (const char* found = scalar_prefix(first, last, [&delimiters](char c) { return !delimiters.contains(c); }))
+        return found;
+#if defined(__SSE2__)
+      if (delimiters.is_vectorizable())
+      {
+        if (const char* found = scan_blocks<true>(first, last, delimiters))
+          return found;
+      }
+#endif
+      for (; first != last; ++first)
+      {
+        if (!delimiters.contains(*first))
+          return first;
+      }
+      return last;
+    }
+  }
+}
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef EZY_BITS_COPYABLE_BOX_H_INCLUDED
+#define EZY_BITS_COPYABLE_BOX_H_INCLUDED
+
+#include <ezy/type_traits.h>
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * copyable_box holds a copy constructible object and makes it copy assignable, even if the object itself is
+   * not (eg. lambdas). Iterators storing functors have to be assignable to be usable by standard algorithms.
+   */
+  template <typename T, typename = void>
+  struct copyable_box
+  {
+    static_assert(std::is_copy_constructible_v<T>, "T must be copy constructible");
+
+    constexpr explicit copyable_box(const T& t)
+      : storage(t)
+    {}
+
+    constexpr explicit copyable_box(T&& t)
+      : storage(std::move(t))
+    {}
+
+    constexpr copyable_box(const copyable_box&) = default;
+    constexpr copyable_box(copyable_box&&) = default;
+
+    copyable_box& operator=(const copyable_box& rhs)
+    {
+      if (this != &rhs)
+      {
+        if (rhs.storage)
+          storage.emplace(*rhs.storage);
+        else
+          storage.reset();
+      }
+      return *this;
+    }
+
+    copyable_box& operator=(copyable_box&& rhs)
+    {
+      if (this != &rhs)
+      {
+        if (rhs.storage)
+          storage.emplace(std::move(*rhs.storage));
+        else
+          storage.reset();
+      }
+      return *this;
+    }
+
+    constexpr T& get() noexcept
+    { return *storage; }
+
+    constexpr const T& get() const noexcept
+    { return *storage; }
+
+    private:
+      std::optional<T> storage;
+  };
+
+  template <typename T>
+  struct copyable_box<T, std::enable_if_t<std::is_copy_assignable_v<T>>>
+  {
+    constexpr explicit copyable_box(const T& t)
+      : storage(t)
+    {}
+
+    constexpr explicit copyable_box(T&& t)
+      : storage(std::move(t))
+    {}
+
+    constexpr T& get() noexcept
+    { return storage; }
+
+    constexpr const T& get() const noexcept
+    { return storage; }
+
+    private:
+      T storage;
+  };
+}
+}
+
+#endif
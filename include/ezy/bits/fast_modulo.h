@@ -0,0 +1,49 @@
+#ifndef EZY_BITS_FAST_MODULO_H_INCLUDED
+#define EZY_BITS_FAST_MODULO_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ezy
+{
+namespace detail
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+  /**
+   * fast_modulo computes `n % divisor` for a fixed, non-zero divisor by a multiplication instead of a division
+   * (Lemire et al., "Faster Remainder by Direct Computation"), if both fit into 32 bits. Larger values fall back
+   * to `%`.
+   */
+  struct fast_modulo
+  {
+    constexpr explicit fast_modulo(std::size_t divisor)
+      : divisor(divisor)
+      , multiplier(divisor <= max_fast ? std::numeric_limits<std::uint64_t>::max() / divisor + 1 : 0)
+    {}
+
+    constexpr std::size_t operator()(std::size_t n) const
+    {
+#if defined(__SIZEOF_INT128__)
+      if (multiplier != 0 && n <= max_fast)
+      {
+        const std::uint64_t low_bits = multiplier * static_cast<std::uint64_t>(n);
+        return static_cast<std::size_t>((static_cast<uint128_t>(low_bits) * divisor) >> 64);
+      }
+#endif
+      return n % divisor;
+    }
+
+    std::size_t divisor;
+    std::uint64_t multiplier;
+
+    private:
+      static constexpr std::size_t max_fast = std::numeric_limits<std::uint32_t>::max();
+  };
+}
+}
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef EZY_BITS_FOLD_LANES_H_INCLUDED
+#define EZY_BITS_FOLD_LANES_H_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * Number of independent accumulators used by the kernels below: as many as fit into 64 bytes (two AVX2 or
+   * four SSE registers).
+   */
+  template <typename T>
+  constexpr std::size_t lane_count_v = std::max<std::size_t>(4, 64 / sizeof(T));
+
+  template <typename Acc>
+  using lanes_t = std::array<Acc, lane_count_v<Acc>>;
+
+  /**
+   * Folds [first, last) into `lanes` (lane `j` takes every element whose offset is `j` modulo the number of
+   * lanes), then folds the lanes and the remaining elements from left to right.
+   *
+   * The lanes do not depend on each other, so the compiler can keep them in vector registers without being
+   * allowed to reassociate floating point operations. As the order of the elements is changed, `op` must be
+   * associative and commutative.
+   */
+  template <typename Acc, typename T, typename BinaryOp>
+  constexpr Acc fold_lanes(lanes_t<Acc> lanes, const T* first, const T* last, BinaryOp& op)
+  {
+    constexpr auto lane_count = lane_count_v<Acc>;
+    for (; static_cast<std::size_t>(last - first) >= lane_count; first += lane_count)
+    {
+      for (std::size_t j = 0; j < lane_count; ++j)
+        lanes[j] = op(lanes[j], first[j]);
+    }
+
+    Acc result = lanes[0];
+    for (std::size_t j = 1; j < lane_count; ++j)
+      result = op(result, lanes[j]);
+
+    for (; first != last; ++first)
+      result = op(result, *first);
+
+    return result;
+  }
+
+  /**
+   * Reduces [first, last) starting from `init`, using lanes seeded by the first elements. Short inputs are
+   * reduced from left to right.
+   */
+  template <typename Acc, typename T, typename BinaryOp>
+  constexpr Acc reduce_lanes(const T* first, const T* last, Acc init, BinaryOp& op)
+  {
+    constexpr auto lane_count = lane_count_v<Acc>;
+    if (static_cast<std::size_t>(last - first) < lane_count)
+    {
+      for (; first != last; ++first)
+        init = op(std::move(init), *first);
+      return init;
+    }
+
+    lanes_t<Acc> lanes{};
+    for (std::size_t j = 0; j < lane_count; ++j)
+      lanes[j] = static_cast<Acc>(first[j]);
+
+    return op(std::move(init), fold_lanes<Acc>(lanes, first + lane_count, last, op));
+  }
+
+  /**
+   * Returns the smallest (or, with `std::greater<>`, the largest) element of the non-empty [first, last), as
+   * `std::min_element` would find it: every lane is seeded by the first element, so a leading NaN is returned,
+   * other NaNs are skipped.
+   */
+  template <typename T, typename Compare>
+  constexpr T extremum_lanes(const T* first, const T* last, Compare compare)
+  {
+    auto select = [&compare](T a, T b) { return compare(b, a) ? b : a; };
+    lanes_t<T> lanes{};
+    lanes.fill(*first);
+    return fold_lanes<T>(lanes, first, last, select);
+  }
+
+  /**
+   * Returns the smallest and the largest element of the non-empty [first, last) in a single pass.
+   */
+  template <typename T>
+  constexpr std::pair<T, T> minmax_lanes(const T* first, const T* last)
+  {
+    constexpr auto lane_count = lane_count_v<T>;
+    lanes_t<T> mins{};
+    lanes_t<T> maxs{};
+    mins.fill(*first);
+    maxs.fill(*first);
+    for (; static_cast<std::size_t>(last - first) >= lane_count; first += lane_count)
+    {
+      for (std::size_t j = 0; j < lane_count; ++j)
+      {
+        mins[j] = first[j] < mins[j] ? first[j] : mins[j];
+        maxs[j] = maxs[j] < first[j] ? first[j] : maxs[j];
+      }
+    }
+
+    std::pair<T, T> result(mins[0], maxs[0]);
+    for (std::size_t j = 1; j < lane_count; ++j)
+    {
+      result.first = mins[j] < result.first ? mins[j] : result.first;
+      result.second = result.second < maxs[j] ? maxs[j] : result.second;
+    }
+
+    for (; first != last; ++first)
+    {
+      result.first = *first < result.first ? *first : result.first;
+      result.second = result.second < *first ? *first : result.second;
+    }
+
+    return result;
+  }
+
+  /**
+   * Returns the position of the element found by extremum_lanes.
+   */
+  template <typename T, typename Compare>
+  constexpr const T* extremum_element_lanes(const T* first, const T* last, Compare compare)
+  {
+    if (first == last)
+      return last;
+
+    const T value = extremum_lanes(first, last, compare);
+    if (!(value == value)) // NaN, only the first element can be the result
+      return first;
+
+    return std::find(first, last, value);
+  }
+}
+}
+
+#endif
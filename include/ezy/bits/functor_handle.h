@@ -0,0 +1,95 @@
+#ifndef EZY_BITS_FUNCTOR_HANDLE_H_INCLUDED
+#define EZY_BITS_FUNCTOR_HANDLE_H_INCLUDED
+
+#include <ezy/bits/copyable_box.h>
+
+#include <type_traits>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * functor_handle is how iterators reach the functor of their view (eg. the transformation of a transformed
+   * range).
+   *
+   * Stateful functors (eg. lambdas with captures) stay in the view, and the handle points to them, so they are
+   * not copied into each iterator. The view must outlive its iterators, as for `std::ranges` views.
+   *
+   * Iterators derive from the handle, so the empty handle of a stateless functor takes no space.
+   */
+  template <typename F, typename = void>
+  struct functor_handle
+  {
+    constexpr explicit functor_handle(const F& f) noexcept
+      : f(&f)
+    {}
+
+    constexpr const F& functor() const noexcept
+    { return *f; }
+
+    private:
+      const F* f;
+  };
+
+  /**
+   * Stateless functors are copied into the empty base of the handle. Assignment has nothing to copy, so it
+   * works for lambdas too.
+   */
+  template <typename F>
+  struct functor_handle<F, std::enable_if_t<std::is_empty_v<F> && std::is_copy_constructible_v<F> && !std::is_final_v<F>>>
+    : private F
+  {
+    constexpr explicit functor_handle(const F& f)
+      : F(f)
+    {}
+
+    constexpr functor_handle(const functor_handle&) = default;
+
+    constexpr functor_handle& operator=(const functor_handle&) noexcept
+    { return *this; }
+
+    constexpr const F& functor() const noexcept
+    { return *this; }
+  };
+
+  /**
+   * Functors which can be called only as non-const (eg. mutable lambdas) can not be shared by the iterators of a
+   * view, so each iterator calls its own copy.
+   */
+  template <typename F>
+  struct functor_copy
+  {
+    constexpr explicit functor_copy(const F& f)
+      : f(f)
+    {}
+
+    constexpr F& functor() noexcept
+    { return f.get(); }
+
+    constexpr const F& functor() const noexcept
+    { return f.get(); }
+
+    private:
+      copyable_box<F> f;
+  };
+
+  /**
+   * Stores nothing, for iterators which reach their functor through their view.
+   */
+  struct no_functor
+  {};
+
+  /**
+   * How an iterator calling `F` with `Args` stores it.
+   */
+  template <typename F, typename... Args>
+  using functor_storage_t = std::conditional_t<
+    std::is_invocable_v<const std::decay_t<F>&, Args...>,
+    functor_handle<std::decay_t<F>>,
+    functor_copy<std::decay_t<F>>
+  >;
+}
+}
+
+#endif
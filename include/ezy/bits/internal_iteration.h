@@ -0,0 +1,50 @@
+#ifndef EZY_BITS_INTERNAL_ITERATION_H_INCLUDED
+#define EZY_BITS_INTERNAL_ITERATION_H_INCLUDED
+
+#include <ezy/bits/priority_tag.h>
+#include <ezy/bits/sentinel.h>
+
+#include <iterator>
+#include <utility>
+
+namespace ezy
+{
+namespace detail
+{
+  template <typename Range, typename Fn>
+  constexpr bool for_each_until_impl(Range& range, Fn& fn, priority_tag<0>)
+  {
+    using std::begin;
+    auto first = begin(range);
+    const auto last = end_or_sentinel(range);
+    for (; first != last; ++first)
+    {
+      if (!fn(*first))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename Range, typename Fn>
+  constexpr auto for_each_until_impl(Range& range, Fn& fn, priority_tag<1>) -> decltype(bool(range.for_each_until(fn)))
+  {
+    return range.for_each_until(fn);
+  }
+
+  /**
+   * Internal iteration: calls `fn` with the elements of `range` until it returns false. Returns false if the
+   * iteration has been stopped by `fn`, true otherwise.
+   *
+   * Views made of segments (eg. concatenated or flattened ranges) provide a `for_each_until` member, which runs
+   * a separate loop on each segment instead of checking segment boundaries on every increment. Other ranges are
+   * iterated from begin to their end or sentinel.
+   */
+  template <typename Range, typename Fn>
+  constexpr bool for_each_until(Range& range, Fn&& fn)
+  {
+    return for_each_until_impl(range, fn, priority_tag<1>{});
+  }
+}
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef EZY_BITS_NON_PROPAGATING_CACHE_H_INCLUDED
+#define EZY_BITS_NON_PROPAGATING_CACHE_H_INCLUDED
+
+#include <optional>
+#include <utility>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * non_propagating_cache stores a lazily computed value of a view (eg. an iterator into the underlying range).
+   *
+   * Copying or moving a view must not copy its cache, because the cached value may refer to the source
+   * object, so the cache of the new object is always empty.
+   */
+  template <typename T>
+  struct non_propagating_cache
+  {
+    constexpr non_propagating_cache() noexcept = default;
+
+    constexpr non_propagating_cache(const non_propagating_cache&) noexcept
+    {}
+
+    non_propagating_cache(non_propagating_cache&& rhs) noexcept
+    {
+      rhs.reset();
+    }
+
+    non_propagating_cache& operator=(const non_propagating_cache& rhs) noexcept
+    {
+      if (this != &rhs)
+        reset();
+      return *this;
+    }
+
+    non_propagating_cache& operator=(non_propagating_cache&& rhs) noexcept
+    {
+      reset();
+      rhs.reset();
+      return *this;
+    }
+
+    constexpr bool has_value() const noexcept
+    { return value.has_value(); }
+
+    constexpr T& operator*() noexcept
+    { return *value; }
+
+    constexpr const T& operator*() const noexcept
+    { return *value; }
+
+    template <typename... Args>
+    T& emplace(Args&&... args)
+    { return value.emplace(std::forward<Args>(args)...); }
+
+    /**
+     * Returns the cached value, computes it by `fn` if the cache is empty.
+     */
+    template <typename Fn>
+    T& get_or_emplace(Fn&& fn)
+    {
+      if (!value.has_value())
+        value.emplace(std::forward<Fn>(fn)());
+      return *value;
+    }
+
+    void reset() noexcept
+    { value = std::nullopt; }
+
+    private:
+      std::optional<T> value;
+  };
+
+  /**
+   * Placeholder for views which do not need to cache anything, eg. because the value can be computed in
+   * constant time.
+   */
+  struct no_cache
+  {};
+}
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef EZY_BITS_PARTITION_H_INCLUDED
+#define EZY_BITS_PARTITION_H_INCLUDED
+
+#include <ezy/bits/priority_tag.h>
+#include <ezy/bits/range_utils.h>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * A range is partitionable if it can be split into independently iterable parts in constant time, eg. to
+   * process them on multiple threads.
+   *
+   * The parts are given as [from, until) intervals of positions, in `[0, partition_extent(range))`. Random
+   * access sized ranges are partitionable by their indices. Views can provide `partition_extent()` and
+   * `for_each_until_in(from, until, fn)` members to be partitioned by the positions of their underlying range
+   * (eg. filter, which yields only some of the elements of a part).
+   */
+  template <typename Range, typename = void>
+  struct has_member_partition : std::false_type {};
+
+  template <typename Range>
+  struct has_member_partition<Range, void_t<decltype(std::declval<const Range&>().partition_extent())>> : std::true_type {};
+
+  template <typename Range>
+  struct is_partitionable
+  {
+    using type = ezy::remove_cvref_t<Range>;
+    static constexpr bool value = has_member_partition<type>::value
+      || (is_sized_range_v<type> && does_range_iterator_implement_v<type, std::random_access_iterator_tag>);
+  };
+
+  template <typename Range>
+  constexpr bool is_partitionable_v = is_partitionable<Range>::value;
+
+  template <typename Range>
+  constexpr std::size_t partition_extent_impl(const Range& range, priority_tag<0>)
+  {
+    return static_cast<std::size_t>(ezy::size(range));
+  }
+
+  template <typename Range>
+  constexpr auto partition_extent_impl(const Range& range, priority_tag<1>) -> decltype(std::size_t(range.partition_extent()))
+  {
+    return range.partition_extent();
+  }
+
+  template <typename Range>
+  constexpr std::size_t partition_extent(const Range& range)
+  {
+    return partition_extent_impl(range, priority_tag<1>{});
+  }
+
+  template <typename Range, typename Fn>
+  constexpr bool for_each_until_in_impl(Range& range, std::size_t from, std::size_t until, Fn& fn, priority_tag<0>)
+  {
+    using std::begin;
+    using difference_type = typename std::iterator_traits<decltype(begin(range))>::difference_type;
+    auto first = std::next(begin(range), static_cast<difference_type>(from));
+    const auto last = std::next(first, static_cast<difference_type>(until - from));
+    for (; first != last; ++first)
+    {
+      if (!fn(*first))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename Range, typename Fn>
+  constexpr auto for_each_until_in_impl(Range& range, std::size_t from, std::size_t until, Fn& fn, priority_tag<1>)
+    -> decltype(bool(range.for_each_until_in(from, until, fn)))
+  {
+    return range.for_each_until_in(from, until, fn);
+  }
+
+  /**
+   * Mutable begin() of some views caches its result (eg. drop, slice). Calling it once before the parts are
+   * iterated on multiple threads leaves only reads of the cache to them.
+   */
+  template <typename Range>
+  void prepare_parts(Range& range)
+  {
+    using std::begin;
+    static_cast<void>(begin(range));
+  }
+
+  /**
+   * Internal iteration (see for_each_until) of the part [from, until) of a partitionable range.
+   */
+  template <typename Range, typename Fn>
+  constexpr bool for_each_until_in(Range& range, std::size_t from, std::size_t until, Fn&& fn)
+  {
+    return for_each_until_in_impl(range, from, until, fn, priority_tag<1>{});
+  }
+}
+}
+
+#endif
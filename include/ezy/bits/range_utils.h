@@ -4,12 +4,23 @@
 #include <ezy/size.h>
 #include <ezy/type_traits.h>
 
+#include <iterator>
+
 namespace ezy
 {
 namespace detail
 {
-  template <typename T>
+  /**
+   * Ranges which can be iterated only as mutable (eg. cache_latest) have no const iterator, it is void for them.
+   */
+  template <typename T, typename = void>
   struct const_iterator_type
+  {
+    using type = void;
+  };
+
+  template <typename T>
+  struct const_iterator_type<T, void_t<decltype(std::begin(std::declval<const T>()))>>
   {
     using type = decltype(std::begin(std::declval<const T>()));
   };
@@ -77,6 +88,70 @@ namespace detail
 
   template <typename T>
   using size_type_t = typename size_type<T>::type;
+
+  /**
+   * A range is sized if its size can be determined without traversing it: it has a member or a free `size()`,
+   * it is an array, or its iterators are random access.
+   */
+  template <typename T, typename = void>
+  struct has_member_size : std::false_type {};
+
+  template <typename T>
+  struct has_member_size<T, void_t<decltype(std::declval<const T&>().size())>> : std::true_type {};
+
+  namespace adl_size
+  {
+    void size(); // hides ezy::size, so only argument dependent lookup can find a candidate
+
+    template <typename T, typename = void>
+    struct has_free_size : std::false_type {};
+
+    template <typename T>
+    struct has_free_size<T, void_t<decltype(size(std::declval<const T&>()))>> : std::true_type {};
+  }
+
+  using adl_size::has_free_size;
+
+  template <typename T>
+  struct is_sized_range
+  {
+    using type = ezy::remove_cvref_t<T>;
+    static constexpr bool value = has_member_size<type>::value
+      || has_free_size<type>::value
+      || std::is_array<type>::value
+      || does_range_iterator_implement_v<type, std::random_access_iterator_tag>;
+  };
+
+  template <typename T>
+  constexpr bool is_sized_range_v = is_sized_range<T>::value;
+
+  /**
+   * A range is contiguous if it is sized and its elements are stored in an array, accessible via `std::data()`.
+   */
+  template <typename T, typename = void>
+  struct is_contiguous_range : std::false_type {};
+
+  template <typename T>
+  struct is_contiguous_range<T, void_t<decltype(std::data(std::declval<T&>()))>>
+    : std::bool_constant<std::is_pointer_v<decltype(std::data(std::declval<T&>()))> && is_sized_range_v<T>>
+  {};
+
+  template <typename T>
+  constexpr bool is_contiguous_range_v = is_contiguous_range<T>::value;
+
+  /**
+   * Contiguous ranges of arithmetic elements can be processed by the kernels in ezy/bits/fold_lanes.h.
+   */
+  template <typename T, typename = void>
+  struct is_contiguous_arithmetic_range : std::false_type {};
+
+  template <typename T>
+  struct is_contiguous_arithmetic_range<T, std::enable_if_t<is_contiguous_range_v<T>>>
+    : std::is_arithmetic<std::remove_pointer_t<decltype(std::data(std::declval<T&>()))>>
+  {};
+
+  template <typename T>
+  constexpr bool is_contiguous_arithmetic_range_v = is_contiguous_arithmetic_range<T>::value;
 }
 }
 
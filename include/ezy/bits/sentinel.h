@@ -0,0 +1,37 @@
+#ifndef EZY_BITS_SENTINEL_H_INCLUDED
+#define EZY_BITS_SENTINEL_H_INCLUDED
+
+#include <ezy/bits/priority_tag.h>
+#include <iterator>
+
+namespace ezy
+{
+namespace detail
+{
+  template <typename Range>
+  constexpr auto end_or_sentinel_impl(Range& range, priority_tag<0>)
+  {
+    using std::end;
+    return end(range);
+  }
+
+  template <typename Range>
+  constexpr auto end_or_sentinel_impl(Range& range, priority_tag<1>) -> decltype(range.sentinel())
+  {
+    return range.sentinel();
+  }
+
+  /**
+   * Returns the cheapest object which marks the end of `range`: its sentinel if it provides one via a
+   * `sentinel()` member, `end(range)` otherwise. The result can only be compared with iterators of `range`, so
+   * it is for loops written by ezy, not for iterator-pair APIs.
+   */
+  template <typename Range>
+  constexpr auto end_or_sentinel(Range& range)
+  {
+    return end_or_sentinel_impl(range, priority_tag<1>{});
+  }
+}
+}
+
+#endif
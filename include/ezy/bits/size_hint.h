@@ -0,0 +1,118 @@
+#ifndef EZY_BITS_SIZE_HINT_H_INCLUDED
+#define EZY_BITS_SIZE_HINT_H_INCLUDED
+
+#include <ezy/bits/priority_tag.h>
+#include <ezy/bits/range_utils.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * Bounds of the number of elements of a range, which can be determined without traversing it. The upper
+   * bound is empty if it is unknown (or the range is infinite).
+   */
+  struct size_hint_t
+  {
+    static constexpr size_hint_t exact(std::size_t size)
+    { return size_hint_t{size, size}; }
+
+    constexpr bool is_exact() const
+    { return upper.has_value() && *upper == lower; }
+
+    std::size_t lower{0};
+    std::optional<std::size_t> upper{};
+  };
+
+  template <typename Range>
+  constexpr size_hint_t size_hint_impl(const Range&, priority_tag<0>)
+  {
+    return {};
+  }
+
+  template <typename Range, typename = std::enable_if_t<is_sized_range_v<Range>>>
+  constexpr size_hint_t size_hint_impl(const Range& range, priority_tag<1>)
+  {
+    return size_hint_t::exact(static_cast<std::size_t>(ezy::size(range)));
+  }
+
+  template <typename Range>
+  constexpr auto size_hint_impl(const Range& range, priority_tag<2>) -> decltype(size_hint_t(range.size_hint()))
+  {
+    return range.size_hint();
+  }
+
+  /**
+   * Returns the size hint of a range: views provide it by a `size_hint()` member, sized ranges have exact hints.
+   */
+  template <typename Range>
+  constexpr size_hint_t size_hint(const Range& range)
+  {
+    return size_hint_impl(range, priority_tag<2>{});
+  }
+
+  /**
+   * Helpers for views to derive their hints from the hints of their underlying ranges.
+   */
+  constexpr size_hint_t at_most_hint(const size_hint_t& hint)
+  {
+    return size_hint_t{0, hint.upper};
+  }
+
+  constexpr size_hint_t take_hint(const size_hint_t& hint, std::size_t n)
+  {
+    return size_hint_t{std::min(hint.lower, n), hint.upper ? std::min(*hint.upper, n) : n};
+  }
+
+  constexpr size_hint_t drop_hint(const size_hint_t& hint, std::size_t n)
+  {
+    const auto saturating_sub = [n](std::size_t size) { return size > n ? size - n : std::size_t{0}; };
+    return size_hint_t{
+      saturating_sub(hint.lower),
+      hint.upper ? std::optional<std::size_t>(saturating_sub(*hint.upper)) : std::nullopt
+    };
+  }
+
+  constexpr size_hint_t ceil_div_hint(const size_hint_t& hint, std::size_t n)
+  {
+    const auto ceil_div = [n](std::size_t size) { return (size + n - 1) / n; };
+    return size_hint_t{
+      ceil_div(hint.lower),
+      hint.upper ? std::optional<std::size_t>(ceil_div(*hint.upper)) : std::nullopt
+    };
+  }
+
+  constexpr size_hint_t sum_hints(const size_hint_t& lhs, const size_hint_t& rhs)
+  {
+    return size_hint_t{
+      lhs.lower + rhs.lower,
+      lhs.upper && rhs.upper ? std::optional<std::size_t>(*lhs.upper + *rhs.upper) : std::nullopt
+    };
+  }
+
+  constexpr size_hint_t min_hints(const size_hint_t& lhs, const size_hint_t& rhs)
+  {
+    if (!lhs.upper)
+      return size_hint_t{std::min(lhs.lower, rhs.lower), rhs.upper};
+    return take_hint(size_hint_t{std::min(lhs.lower, rhs.lower), rhs.upper}, *lhs.upper);
+  }
+
+  /**
+   * Number of elements to reserve for a range with the given hint: the upper bound if it is known and at most
+   * `limit` (or exact), the lower bound otherwise, so a selective filter over a large range does not allocate
+   * for the elements it drops.
+   */
+  constexpr std::size_t reserve_hint(const size_hint_t& hint, std::size_t limit)
+  {
+    if (hint.upper && *hint.upper <= std::max(hint.lower, limit))
+      return *hint.upper;
+    return hint.lower;
+  }
+}
+}
+
+#endif
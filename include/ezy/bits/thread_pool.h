@@ -0,0 +1,214 @@
+#ifndef EZY_BITS_THREAD_POOL_H_INCLUDED
+#define EZY_BITS_THREAD_POOL_H_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * thread_pool runs tasks on a fixed number of worker threads.
+   *
+   * Every worker has its own task queue: it takes tasks from the back of its own queue, and when it runs out
+   * of work, it steals from the front of the others. The thread waiting for a batch of tasks (see run_batch)
+   * does not block while there are tasks to run, it takes them as well, so batches can be nested.
+   */
+  class thread_pool
+  {
+    public:
+      using task_type = std::function<void()>;
+
+      explicit thread_pool(std::size_t thread_count = default_thread_count())
+      {
+        thread_count = std::max<std::size_t>(1, thread_count);
+        queues.reserve(thread_count);
+        for (std::size_t i = 0; i < thread_count; ++i)
+          queues.push_back(std::make_unique<task_queue>());
+
+        workers.reserve(thread_count);
+        for (std::size_t i = 0; i < thread_count; ++i)
+          workers.emplace_back([this, i] { work(i); });
+      }
+
+      thread_pool(const thread_pool&) = delete;
+      thread_pool& operator=(const thread_pool&) = delete;
+
+      ~thread_pool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(sleep_mutex);
+          stopping = true;
+        }
+        wake_up.notify_all();
+        for (auto& worker : workers)
+          worker.join();
+      }
+
+      /**
+       * The pool used by the parallel algorithms, with a worker for each hardware thread.
+       */
+      static thread_pool& shared()
+      {
+        static thread_pool pool;
+        return pool;
+      }
+
+      static std::size_t default_thread_count()
+      {
+        return std::max(1u, std::thread::hardware_concurrency());
+      }
+
+      std::size_t size() const noexcept
+      { return workers.size(); }
+
+      /**
+       * Calls `fn(i)` for every i in [0, count), and returns when all of them are finished. The first exception
+       * thrown by `fn` is rethrown.
+       */
+      template <typename Fn>
+      void run_batch(std::size_t count, Fn& fn)
+      {
+        if (count == 0)
+          return;
+
+        batch_state state{count};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          push(i % queues.size(), [&state, &fn, i] {
+              std::exception_ptr error;
+              try
+              {
+                fn(i);
+              }
+              catch (...)
+              {
+                error = std::current_exception();
+              }
+
+              // the state must not be touched after the last task released the lock
+              std::lock_guard<std::mutex> lock(state.mutex);
+              if (error && !state.error)
+                state.error = error;
+              if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                state.done.notify_all();
+          });
+        }
+
+        while (state.remaining.load(std::memory_order_acquire) != 0)
+        {
+          task_type task;
+          if (try_take(0, task))
+          {
+            task();
+            continue;
+          }
+
+          std::unique_lock<std::mutex> lock(state.mutex);
+          state.done.wait(lock, [&state] { return state.remaining.load(std::memory_order_acquire) == 0; });
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex); // waits for the last task to release the state
+        if (state.error)
+          std::rethrow_exception(state.error);
+      }
+
+    private:
+      struct task_queue
+      {
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+      };
+
+      struct batch_state
+      {
+        explicit batch_state(std::size_t count)
+          : remaining(count)
+        {}
+
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+      };
+
+      void push(std::size_t index, task_type task)
+      {
+        {
+          std::lock_guard<std::mutex> lock(queues[index]->mutex);
+          queues[index]->tasks.push_back(std::move(task));
+        }
+        {
+          std::lock_guard<std::mutex> lock(sleep_mutex);
+          ++pending;
+        }
+        wake_up.notify_one();
+      }
+
+      bool try_take(std::size_t index, task_type& task)
+      {
+        for (std::size_t i = 0; i < queues.size(); ++i)
+        {
+          auto& queue = *queues[(index + i) % queues.size()];
+          std::lock_guard<std::mutex> lock(queue.mutex);
+          if (queue.tasks.empty())
+            continue;
+
+          if (i == 0) // own queue
+          {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+          }
+          else // steal the oldest task
+          {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+          }
+
+          std::lock_guard<std::mutex> sleep_lock(sleep_mutex);
+          --pending;
+          return true;
+        }
+        return false;
+      }
+
+      void work(std::size_t index)
+      {
+        for (;;)
+        {
+          task_type task;
+          if (try_take(index, task))
+          {
+            task();
+            continue;
+          }
+
+          std::unique_lock<std::mutex> lock(sleep_mutex);
+          wake_up.wait(lock, [this] { return stopping || pending != 0; });
+          if (stopping)
+            return;
+        }
+      }
+
+      std::vector<std::unique_ptr<task_queue>> queues;
+      std::vector<std::thread> workers;
+
+      std::mutex sleep_mutex;
+      std::condition_variable wake_up;
+      std::size_t pending{0};
+      bool stopping{false};
+  };
+}
+}
+
+#endif
@@ -17,9 +17,9 @@ namespace ezy
     }
 
     template <typename T>
-    constexpr auto impl_empty(const T& t, priority_tag<1>) -> decltype(t.size())
+    constexpr auto impl_empty(const T& t, priority_tag<1>) -> decltype(t.size() == 0)
     {
-      return t.size() != 0;
+      return t.size() == 0;
     }
 
     template <typename T>
@@ -0,0 +1,91 @@
+#ifndef EZY_EXECUTION_H_INCLUDED
+#define EZY_EXECUTION_H_INCLUDED
+
+#include <ezy/bits/thread_pool.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace ezy
+{
+namespace execution
+{
+  struct sequenced_tag {};
+  struct parallel_tag {};
+  struct parallel_unsequenced_tag {};
+
+  /**
+   * Execution policies for the overloads in ezy/algorithm/parallel.h.
+   *
+   * Parallel algorithms split partitionable ranges (see detail::is_partitionable) into chunks and process them
+   * on a shared thread pool. `with_chunk_size` overrides the automatically chosen chunk size.
+   */
+  template <typename Tag>
+  struct execution_policy
+  {
+    constexpr execution_policy with_chunk_size(std::size_t size) const
+    {
+      return execution_policy{size};
+    }
+
+    std::size_t chunk_size{0}; // 0: automatic
+  };
+
+  using sequenced_policy = execution_policy<sequenced_tag>;
+  using parallel_policy = execution_policy<parallel_tag>;
+  using parallel_unsequenced_policy = execution_policy<parallel_unsequenced_tag>;
+}
+
+  static constexpr execution::sequenced_policy seq{};
+  static constexpr execution::parallel_policy par{};
+  static constexpr execution::parallel_unsequenced_policy par_unseq{};
+
+namespace detail
+{
+  template <typename Tag>
+  constexpr bool is_parallel_policy_v = !std::is_same_v<Tag, execution::sequenced_tag>;
+
+  /**
+   * Parts smaller than this are not worth to be scheduled separately.
+   */
+  static constexpr std::size_t min_automatic_chunk_size = 4096;
+
+  template <typename Tag>
+  std::size_t chunk_count_for(const execution::execution_policy<Tag>& policy, std::size_t extent)
+  {
+    if (extent == 0)
+      return 0;
+
+    if (policy.chunk_size != 0)
+      return (extent + policy.chunk_size - 1) / policy.chunk_size;
+
+    // a few chunks for each worker, so the faster ones can steal from the slower ones
+    const auto max_chunks = thread_pool::shared().size() * 4;
+    return std::max<std::size_t>(1, std::min(max_chunks, extent / min_automatic_chunk_size));
+  }
+
+  /**
+   * Splits [0, extent) into `chunk_count` contiguous chunks (see chunk_count_for) and calls
+   * `fn(chunk_index, from, until)` for each of them on the shared thread pool.
+   */
+  template <typename Fn>
+  void parallel_chunks(std::size_t chunk_count, std::size_t extent, Fn&& fn)
+  {
+    auto run_chunk = [&fn, extent, chunk_count](std::size_t index)
+    {
+      // distributing the remainder, so chunk sizes differ at most by one
+      const auto from = extent / chunk_count * index + std::min(index, extent % chunk_count);
+      const auto until = from + extent / chunk_count + (index < extent % chunk_count ? 1 : 0);
+      fn(index, from, until);
+    };
+
+    if (chunk_count == 1)
+      run_chunk(0);
+    else
+      thread_pool::shared().run_batch(chunk_count, run_chunk);
+  }
+}
+}
+
+#endif
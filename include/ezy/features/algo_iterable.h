@@ -80,19 +80,19 @@ namespace features {
         return static_cast<T&&>(*this).flatten().map(std::forward<UnaryFunction>(f));
       }
 
-      template <typename RhsRange>
-      auto concatenate(RhsRange&& rhs) const &
+      template <typename... RhsRanges>
+      auto concatenate(RhsRanges&&... rhs) const &
       {
         return detail::make_extended_from<T>(
-            ezy::concatenate(static_cast<const T&>(*this).get(), std::forward<RhsRange>(rhs))
+            ezy::concatenate(static_cast<const T&>(*this).get(), std::forward<RhsRanges>(rhs)...)
             );
       }
 
-      template <typename RhsRange>
-      auto concatenate(RhsRange&& rhs) &&
+      template <typename... RhsRanges>
+      auto concatenate(RhsRanges&&... rhs) &&
       {
         return detail::make_extended_from<T>(
-            ezy::concatenate(static_cast<T&&>(*this).get(), std::forward<RhsRange>(rhs))
+            ezy::concatenate(static_cast<T&&>(*this).get(), std::forward<RhsRanges>(rhs)...)
             );
       }
 
@@ -129,25 +129,61 @@ namespace features {
       }
 
       template <typename Type>
-      Type accumulate(Type&& init) const
+      std::decay_t<Type> accumulate(Type&& init) const
       {
         return ezy::accumulate(static_cast<const T&>(*this).get(), std::forward<Type>(init));
       }
 
       template <typename Type, typename BinaryOp>
-      Type accumulate(Type&& init, BinaryOp&& op) const
+      std::decay_t<Type> accumulate(Type&& init, BinaryOp&& op) const
       {
         return ezy::accumulate(static_cast<const T&>(*this).get(), std::forward<Type>(init), std::forward<BinaryOp>(op));
       }
 
-      /*
-       * not found in gcc even if numeric has been included
       template <typename Type>
-      Type reduce(Type init)
+      auto reduce(Type&& init) const
       {
-        return std::reduce(base::underlying().begin(), base::underlying().end(), init);
+        return ezy::reduce(static_cast<const T&>(*this).get(), std::forward<Type>(init));
+      }
+
+      template <typename Type>
+      auto reduce(Type&& init, ezy::reassociate_t policy) const
+      {
+        return ezy::reduce(static_cast<const T&>(*this).get(), std::forward<Type>(init), policy);
+      }
+
+      template <typename Type, typename BinaryOp>
+      auto reduce(Type&& init, BinaryOp&& op) const
+      {
+        return ezy::reduce(static_cast<const T&>(*this).get(), std::forward<Type>(init), std::forward<BinaryOp>(op));
+      }
+
+      template <typename Type, typename BinaryOp>
+      auto reduce(Type&& init, BinaryOp&& op, ezy::reassociate_t policy) const
+      {
+        return ezy::reduce(static_cast<const T&>(*this).get(), std::forward<Type>(init), std::forward<BinaryOp>(op), policy);
+      }
+
+      auto min_element() const
+      {
+        return ezy::min_element(static_cast<const T&>(*this).get());
+      }
+
+      auto max_element() const
+      {
+        return ezy::max_element(static_cast<const T&>(*this).get());
+      }
+
+      auto minmax() const
+      {
+        return ezy::minmax(static_cast<const T&>(*this).get());
+      }
+
+      template <typename Predicate>
+      auto count_if(Predicate&& predicate) const
+      {
+        return ezy::count_if(static_cast<const T&>(*this).get(), std::forward<Predicate>(predicate));
       }
-      */
 
       auto chunk(_size_type chunk_size) const &
       {
@@ -170,6 +206,105 @@ namespace features {
             );
       }
 
+      template <size_t N>
+      auto chunk() const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::chunk<N>(static_cast<const T&>(*this).get())
+            );
+      }
+
+      template <size_t N>
+      auto chunk() &
+      {
+        return detail::make_extended_from<T>(
+            ezy::chunk<N>(static_cast<T&>(*this).get())
+            );
+      }
+
+      template <size_t N>
+      auto chunk() &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::chunk<N>(static_cast<T&&>(*this).get())
+            );
+      }
+
+      template <typename Op>
+      auto rolling(_size_type window_size, Op&& op) const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::rolling(static_cast<const T&>(*this).get(), window_size, std::forward<Op>(op))
+            );
+      }
+
+      template <typename Op>
+      auto rolling(_size_type window_size, Op&& op) &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::rolling(static_cast<T&&>(*this).get(), window_size, std::forward<Op>(op))
+            );
+      }
+
+      auto rolling_mean(_size_type window_size) const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::rolling_mean(static_cast<const T&>(*this).get(), window_size)
+            );
+      }
+
+      auto rolling_mean(_size_type window_size) &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::rolling_mean(static_cast<T&&>(*this).get(), window_size)
+            );
+      }
+
+      auto windows(_size_type window_size) const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows(static_cast<const T&>(*this).get(), window_size)
+            );
+      }
+
+      auto windows(_size_type window_size) &
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows(static_cast<T&>(*this).get(), window_size)
+            );
+      }
+
+      auto windows(_size_type window_size) &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows(static_cast<T&&>(*this).get(), window_size)
+            );
+      }
+
+      template <size_t N>
+      auto windows() const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows<N>(static_cast<const T&>(*this).get())
+            );
+      }
+
+      template <size_t N>
+      auto windows() &
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows<N>(static_cast<T&>(*this).get())
+            );
+      }
+
+      template <size_t N>
+      auto windows() &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::windows<N>(static_cast<T&&>(*this).get())
+            );
+      }
+
       template <typename Predicate>
       auto partition(Predicate&& predicate) const &
       {
@@ -318,6 +453,22 @@ namespace features {
             );
       }
 
+      template <typename Predicate>
+      auto take_while_sorted(Predicate&& pred) const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::take_while_sorted(static_cast<const T&>(*this).get(), std::forward<Predicate>(pred))
+            );
+      }
+
+      template <typename Predicate>
+      auto take_while_sorted(Predicate&& pred) &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::take_while_sorted(static_cast<T&&>(*this).get(), std::forward<Predicate>(pred))
+            );
+      }
+
       auto drop(size_t n) const &
       {
         return detail::make_extended_from<T>(
@@ -339,6 +490,22 @@ namespace features {
             );
       }
 
+      template <typename Predicate>
+      auto drop_while_sorted(Predicate&& pred) const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::drop_while_sorted(static_cast<const T&>(*this).get(), std::forward<Predicate>(pred))
+            );
+      }
+
+      template <typename Predicate>
+      auto drop_while_sorted(Predicate&& pred) &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::drop_while_sorted(static_cast<T&&>(*this).get(), std::forward<Predicate>(pred))
+            );
+      }
+
       template <typename ResultContainer>
       constexpr ResultContainer to() const &
       {
@@ -404,6 +571,34 @@ namespace features {
             ezy::cycle(static_cast<T&&>(*this).get())
             );
       }
+
+      auto cache_latest() const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::cache_latest(static_cast<const T&>(*this).get())
+            );
+      }
+
+      auto cache_latest() &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::cache_latest(static_cast<T&&>(*this).get())
+            );
+      }
+
+      auto memoize_all() const &
+      {
+        return detail::make_extended_from<T>(
+            ezy::memoize_all(static_cast<const T&>(*this).get())
+            );
+      }
+
+      auto memoize_all() &&
+      {
+        return detail::make_extended_from<T>(
+            ezy::memoize_all(static_cast<T&&>(*this).get())
+            );
+      }
     };
   };
 
@@ -0,0 +1,144 @@
+#ifndef EZY_MAPPED_FILE_H_INCLUDED
+#define EZY_MAPPED_FILE_H_INCLUDED
+
+#include <ezy/algorithm/lines.h>
+#include <ezy/algorithm/records.h>
+#include <ezy/features/iterable.h>
+#include <ezy/strong_type.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ezy
+{
+  /**
+   * mapped_file is a read-only, contiguous range of the characters of a file, mapped into memory (POSIX only).
+   *
+   * Views of the file (eg. `lines()`) refer to the mapped pages directly, nothing is copied. Temporary files
+   * are moved into the view, so `ezy::mapped_file(path).lines().filter(...)` is safe to store.
+   *
+   * The kernel is advised that the mapping is read sequentially, as most pipelines stream through the file.
+   */
+  struct mapped_file
+  {
+    using value_type = char;
+    using size_type = std::size_t;
+    using const_iterator = const char*;
+    using iterator = const_iterator;
+
+    /**
+     * Throws std::system_error if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(const std::string& path)
+    {
+      const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd == -1)
+        throw std::system_error(errno, std::generic_category(), "ezy::mapped_file: cannot open " + path);
+
+      struct stat status;
+      if (::fstat(fd, &status) == -1)
+      {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "ezy::mapped_file: cannot stat " + path);
+      }
+
+      length = static_cast<size_type>(status.st_size);
+      if (length > 0)
+      {
+        void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+          const int error = errno;
+          ::close(fd);
+          throw std::system_error(error, std::generic_category(), "ezy::mapped_file: cannot map " + path);
+        }
+        ::madvise(mapping, length, MADV_SEQUENTIAL);
+        address = static_cast<const char*>(mapping);
+      }
+      ::close(fd); // the mapping stays valid
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& rhs) noexcept
+      : address(std::exchange(rhs.address, nullptr))
+      , length(std::exchange(rhs.length, 0))
+    {}
+
+    mapped_file& operator=(mapped_file&& rhs) noexcept
+    {
+      if (this != &rhs)
+      {
+        unmap();
+        address = std::exchange(rhs.address, nullptr);
+        length = std::exchange(rhs.length, 0);
+      }
+      return *this;
+    }
+
+    ~mapped_file()
+    {
+      unmap();
+    }
+
+    const char* data() const noexcept
+    { return address; }
+
+    size_type size() const noexcept
+    { return length; }
+
+    bool empty() const noexcept
+    { return length == 0; }
+
+    const_iterator begin() const noexcept
+    { return address; }
+
+    const_iterator end() const noexcept
+    { return address + length; }
+
+    std::string_view view() const noexcept
+    { return std::string_view(address, length); }
+
+    /**
+     * Lines of the file without the '\n' terminators, as string_views.
+     */
+    auto lines() const &
+    { return ezy::make_extended<ezy::features::iterable>(ezy::lines(*this)); }
+
+    auto lines() &&
+    { return ezy::make_extended<ezy::features::iterable>(ezy::lines(std::move(*this))); }
+
+    /**
+     * Consecutive records of `record_size` characters, as string_views. A trailing partial record is skipped.
+     */
+    auto records(size_type record_size) const &
+    { return ezy::make_extended<ezy::features::iterable>(ezy::records(*this, record_size)); }
+
+    auto records(size_type record_size) &&
+    { return ezy::make_extended<ezy::features::iterable>(ezy::records(std::move(*this), record_size)); }
+
+    private:
+      void unmap() noexcept
+      {
+        if (address != nullptr)
+          ::munmap(const_cast<char*>(address), length);
+        address = nullptr;
+        length = 0;
+      }
+
+      const char* address{nullptr};
+      size_type length{0};
+  };
+}
+
+#endif
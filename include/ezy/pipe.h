@@ -3,6 +3,9 @@
 
 #include "invoke.h"
 
+#include <tuple>
+#include <utility>
+
 namespace ezy
 {
   /**
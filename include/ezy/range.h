@@ -4,15 +4,36 @@
 #include "experimental/tuple_algorithm.h"
 #include "experimental/keeper.h"
 #include "invoke.h"
+#include "pipe.h"
+#include <ezy/math/max.h>
+#include <ezy/math/min.h>
 #include <ezy/bits/range_utils.h> // iterator_type, value_type, etc.
+#include <ezy/bits/char_scan.h>
+#include <ezy/bits/copyable_box.h>
+#include <ezy/bits/fast_modulo.h>
+#include <ezy/bits/functor_handle.h>
+#include <ezy/bits/non_propagating_cache.h>
+#include <ezy/bits/sentinel.h>
+#include <ezy/bits/internal_iteration.h>
+#include <ezy/bits/partition.h>
+#include <ezy/bits/size_hint.h>
 
 #include <type_traits>
 #include <utility>
 #include <iterator>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <optional>
 #include <tuple>
 #include <limits>
+#include <string_view>
+#include <variant>
+#include <vector>
 
 namespace ezy
 {
@@ -92,6 +113,28 @@ namespace detail
   struct end_marker_t
   {};
 
+  /**
+   * Views whose iterators know where their range ends can provide a `sentinel()` beside `end()`. The sentinel
+   * is an empty `end_marker_t`, so comparing with it does not need a fully constructed end iterator.
+   *
+   * Iterators derive from this and implement `is_end()`.
+   */
+  template <typename Iterator>
+  struct compares_to_end_marker
+  {
+    friend constexpr bool operator==(const Iterator& it, end_marker_t)
+    { return it.is_end(); }
+
+    friend constexpr bool operator!=(const Iterator& it, end_marker_t)
+    { return !it.is_end(); }
+
+    friend constexpr bool operator==(end_marker_t, const Iterator& it)
+    { return it.is_end(); }
+
+    friend constexpr bool operator!=(end_marker_t, const Iterator& it)
+    { return !it.is_end(); }
+  };
+
   /**
    * iterator tracker is a collection of iterators to Ranges.
    *
@@ -151,6 +194,15 @@ namespace detail
         ezy::experimental::static_for_each(iters, [](auto& it){ ++it; });
       }
 
+      template <typename Distance>
+      constexpr void advance_all(Distance distance)
+      {
+        ezy::experimental::static_for_each(iters, [distance](auto& it){
+            using difference_type = typename std::iterator_traits<ezy::remove_cvref_t<decltype(it)>>::difference_type;
+            it += static_cast<difference_type>(distance);
+        });
+      }
+
     private:
       std::tuple<Iters...> iters;
   };
@@ -266,7 +318,7 @@ namespace detail
       template <unsigned N>
       bool has_next() const
       {
-        return std::get<N>(current) != std::end(std::get<N>(ranges).get());
+        return std::get<N>(current) != end_or_sentinel(std::get<N>(ranges).get());
       }
 
     private:
@@ -283,53 +335,136 @@ namespace detail
            typename converter_type
            // , typename = IsFunction<converter_type>
            >
-  struct iterator_adaptor : basic_iterator_adaptor<orig_type>
+  struct iterator_adaptor
+    : basic_iterator_adaptor<orig_type>
+    , private functor_storage_t<converter_type, decltype(*std::declval<orig_type&>())>
   {
     public:
       using base = basic_iterator_adaptor<orig_type>;
-      using value_type = decltype(*std::declval<orig_type>());
-      using result_type = decltype(ezy::invoke(std::declval<converter_type>(), std::declval<value_type>()));
-
-      // constructor
-      using base::basic_iterator_adaptor;
-
-      /*
-      iterator_adaptor(orig_type original, converter_type&& c)
-        : base(original)
-        , converter(std::move(c))
-      {}
-      */
+      using stored_converter_type = std::decay_t<converter_type>;
+      using converter_handle = functor_storage_t<converter_type, decltype(*std::declval<orig_type&>())>;
+      using result_type = decltype(ezy::invoke(std::declval<converter_handle&>().functor(), *std::declval<orig_type&>()));
+      using difference_type = typename base::difference_type;
+      using value_type = ezy::remove_cvref_t<result_type>;
+      using reference = result_type;
+      using pointer = void;
+      using iterator_category = typename base::iterator_category;
 
-      constexpr iterator_adaptor(const orig_type& original, const converter_type& c)
+      constexpr iterator_adaptor(const orig_type& original, const stored_converter_type& c)
         : base(original)
-        , converter(c)
+        , converter_handle(c)
       {}
 
-      inline constexpr iterator_adaptor operator+(int increment) const
-      { return iterator_adaptor(base::orig + increment); }
-
       inline constexpr iterator_adaptor& operator++()
       {
         ++base::orig;
         return *this;
       }
 
+      inline constexpr iterator_adaptor operator++(int)
+      {
+        auto copy = *this;
+        ++base::orig;
+        return copy;
+      }
+
+      inline constexpr iterator_adaptor& operator--()
+      {
+        --base::orig;
+        return *this;
+      }
+
+      inline constexpr iterator_adaptor operator--(int)
+      {
+        auto copy = *this;
+        --base::orig;
+        return copy;
+      }
+
+      inline constexpr iterator_adaptor& operator+=(difference_type diff)
+      {
+        base::orig += diff;
+        return *this;
+      }
+
+      inline constexpr iterator_adaptor& operator-=(difference_type diff)
+      {
+        base::orig -= diff;
+        return *this;
+      }
+
+      inline constexpr iterator_adaptor operator+(difference_type diff) const
+      {
+        auto copy = *this;
+        return copy += diff;
+      }
+
+      friend inline constexpr iterator_adaptor operator+(difference_type diff, const iterator_adaptor& it)
+      {
+        return it + diff;
+      }
+
+      inline constexpr iterator_adaptor operator-(difference_type diff) const
+      {
+        auto copy = *this;
+        return copy -= diff;
+      }
+
+      inline constexpr difference_type operator-(const iterator_adaptor& rhs) const
+      { return base::orig - rhs.orig; }
+
       constexpr result_type operator*()
       {
-        return ezy::invoke(converter, *(base::orig));
+        return ezy::invoke(converter_handle::functor(), *(base::orig));
       }
 
-    private:
-      converter_type converter;
+      constexpr result_type operator*() const
+      {
+        return ezy::invoke(converter_handle::functor(), *(base::orig));
+      }
+
+      constexpr result_type operator[](difference_type n) const
+      {
+        return ezy::invoke(converter_handle::functor(), base::orig[n]);
+      }
+
+      inline constexpr bool operator==(const iterator_adaptor& rhs) const
+      { return base::orig == rhs.orig; }
+
+      inline constexpr bool operator!=(const iterator_adaptor& rhs) const
+      { return base::orig != rhs.orig; }
+
+      inline constexpr bool operator<(const iterator_adaptor& rhs) const
+      { return base::orig < rhs.orig; }
+
+      inline constexpr bool operator>(const iterator_adaptor& rhs) const
+      { return base::orig > rhs.orig; }
+
+      inline constexpr bool operator<=(const iterator_adaptor& rhs) const
+      { return base::orig <= rhs.orig; }
+
+      inline constexpr bool operator>=(const iterator_adaptor& rhs) const
+      { return base::orig >= rhs.orig; }
   };
 
+  template <typename View, typename Reference>
+  constexpr bool copies_filter_predicate_v = std::is_const_v<View>
+    && !std::is_invocable_v<const std::decay_t<typename std::remove_const_t<View>::predicate_type>&, Reference>;
+
+  template <typename View, typename Reference>
+  using filter_predicate_storage_t = std::conditional_t<
+    copies_filter_predicate_v<View, Reference>,
+    functor_copy<std::decay_t<typename std::remove_const_t<View>::predicate_type>>,
+    no_functor
+  >;
+
   /**
-   * iterator_filter
+   * iterator_filter: the predicate and the end of the underlying range are reached through the view, so the
+   * iterator is the iterator of the underlying range and a pointer. Predicates which can be called only as
+   * non-const are copied into the iterators of const views.
    */
-  template <typename orig_type,
-            typename predicate_type
-           >
-  struct iterator_filter
+  template <typename View, typename orig_type>
+  struct iterator_filter : private filter_predicate_storage_t<View, typename std::iterator_traits<orig_type>::reference>
   {
     public:
       using value_type = typename std::iterator_traits<orig_type>::value_type;
@@ -338,20 +473,24 @@ namespace detail
       using difference_type = typename std::iterator_traits<orig_type>::difference_type;
       using iterator_category = std::input_iterator_tag; // forward_iterator_tag?
 
-      iterator_filter(orig_type original, const predicate_type& p, const orig_type& end)
-        : orig(original)
-        , end_iterator(end)
-        , predicate(p)
+      static constexpr bool copies_predicate = copies_filter_predicate_v<View, reference>;
+      using predicate_storage = filter_predicate_storage_t<View, reference>;
+
+      iterator_filter(View* view, orig_type original)
+        : predicate_storage(make_predicate_storage(view))
+        , view(view)
+        , orig(original)
       {
-        if (orig != end_iterator && !predicate(*orig))
+        if (orig != std::end(view->orig_range.get()) && !predicate()(*orig))
           operator++();
       }
 
       inline iterator_filter& operator++()
       {
+        const auto end_iterator = std::end(view->orig_range.get());
         ++orig;
         for (; orig != end_iterator; ++orig)
-          if (predicate(*orig))
+          if (predicate()(*orig))
             return *this;
 
         return *this;
@@ -374,94 +513,110 @@ namespace detail
       }
 
     private:
+      static predicate_storage make_predicate_storage(View* view)
+      {
+        if constexpr (copies_predicate)
+          return predicate_storage(view->predicate);
+        else
+          return predicate_storage{};
+      }
+
+      decltype(auto) predicate()
+      {
+        if constexpr (copies_predicate)
+          return predicate_storage::functor();
+        else
+          return (view->predicate);
+      }
+
+      View* view;
       orig_type orig;
-      const orig_type end_iterator;
-      predicate_type predicate;
   };
 
-  template <typename first_range_type, typename second_range_type>
-  struct iterator_concatenator
+  /**
+   * iterator_concatenator iterates over the segments (ranges) of a concatenated_range_view.
+   *
+   * It stores the index of the active segment and an iterator into it (both in a variant), and a pointer to the
+   * view to reach the segment boundaries. So each step costs the same, regardless of the number of segments.
+   */
+  template <typename View>
+  struct iterator_concatenator : compares_to_end_marker<iterator_concatenator<View>>
   {
     public:
-      using orig_type = const_iterator_type_t<first_range_type>;
-      using value_type = decltype(*std::declval<orig_type>());
-      using pointer = std::add_pointer_t<value_type>;
-      using reference = std::add_lvalue_reference_t<value_type>;
-      using difference_type = typename std::iterator_traits<orig_type>::difference_type;
-      using iterator_category = std::input_iterator_tag; // forward_iterator_tag?
+      using segments_type = typename View::template segments_type<std::is_const_v<View>>;
+      static constexpr size_t number_of_segments = std::tuple_size_v<segments_type>;
 
-      // constructor
+      template <size_t I>
+      using segment_type = std::remove_reference_t<std::tuple_element_t<I, segments_type>>;
 
-      iterator_concatenator(const first_range_type& fr, const second_range_type& sr)
-        : tracker(fr, sr)
-      {}
+      template <size_t I>
+      using segment_iterator = iterator_type_t<segment_type<I>>;
 
-      iterator_concatenator(const first_range_type& fr, const second_range_type& sr, end_marker_t&&)
-        : tracker(fr, sr, end_marker_t{})
-      {}
+    private:
+      template <size_t... Is>
+      static auto variant_for(std::index_sequence<Is...>) -> std::variant<segment_iterator<Is>...>;
 
-      inline iterator_concatenator& operator++()
+      template <size_t... Is>
+      static auto reference_for(std::index_sequence<Is...>)
       {
-        {
-          auto tracked = tracking_info<0>();
-          if (tracked.first != tracked.second)
-          {
-            ++tracked.first;
-            return *this;
-          }
-        }
+        if constexpr (std::conjunction_v<std::is_same<decltype(*std::declval<segment_iterator<0>&>()), decltype(*std::declval<segment_iterator<Is>&>())>...>)
+          return ezy::type_identity<decltype(*std::declval<segment_iterator<0>&>())>{};
+        else
+          return ezy::type_identity<std::common_type_t<decltype(*std::declval<segment_iterator<Is>&>())...>>{};
+      }
 
-        {
-          auto tracked = tracking_info<1>();
-          if (tracked.first != tracked.second)
-          {
-            ++tracked.first;
-            return *this;
-          }
-        }
+      template <size_t... Is>
+      static auto difference_for(std::index_sequence<Is...>)
+        -> ezy::type_identity<std::common_type_t<typename std::iterator_traits<segment_iterator<Is>>::difference_type...>>;
 
+      using indices = std::make_index_sequence<number_of_segments>;
+      using storage_type = decltype(variant_for(indices{}));
+
+    public:
+      using reference = typename decltype(reference_for(indices{}))::type;
+      using value_type = ezy::remove_cvref_t<reference>;
+      using pointer = std::add_pointer_t<reference>;
+      using difference_type = typename decltype(difference_for(indices{}))::type;
+      using iterator_category = std::forward_iterator_tag;
+
+      constexpr iterator_concatenator() = default;
+
+      explicit iterator_concatenator(View& v)
+        : view(&v)
+        , current(std::in_place_index<0>, std::begin(v.template segment<0>()))
+      {
+        satisfy<0>();
+      }
+
+      iterator_concatenator(View& v, end_marker_t)
+        : view(&v)
+        , current(std::in_place_index<last_segment>, std::end(v.template segment<last_segment>()))
+      {}
+
+      iterator_concatenator& operator++()
+      {
+        dispatch([this](auto index) {
+            ++std::get<index>(current);
+            satisfy<index>();
+        });
         return *this;
       }
 
-      auto operator*()
+      iterator_concatenator operator++(int)
       {
-        auto tracked = tracking_info<0>();
-        if (tracked.first != tracked.second)
-        {
-          return *tracked.first;
-        }
+        auto copy = *this;
+        ++(*this);
+        return copy;
+      }
 
-        return *tracking_info<1>().first;
+      reference operator*() const
+      {
+        return dispatch([this](auto index) -> reference { return *std::get<index>(current); });
       }
 
       bool operator==(const iterator_concatenator& rhs) const
       {
-        {
-          const auto tracked = tracking_info<0>();
-          if (tracked.first != tracked.second)
-          {
-            const auto r_tracked = rhs.tracking_info<0>();
-            if (r_tracked.first != r_tracked.second)
-              return (r_tracked.first == tracked.first);
-            else
-              return false;
-          }
-        }
-
-        {
-          const auto tracked = tracking_info<1>();
-          if (tracked.first != tracked.second)
-          {
-            const auto r_tracked = rhs.tracking_info<1>();
-            if (r_tracked.first != r_tracked.second)
-              return (r_tracked.first == tracked.first);
-            else
-              return false;
-          }
-        }
-
-        // this ended
-        return !rhs.tracker.template has_next<1>();
+        return current == rhs.current;
       }
 
       bool operator!=(const iterator_concatenator& rhs) const
@@ -469,20 +624,53 @@ namespace detail
         return !(*this == rhs);
       }
 
-      template <unsigned N>
-      auto tracking_info()
+      bool is_end() const
       {
-        return tracker.template get<N>();
+        return current.index() == last_segment
+          && std::get<last_segment>(current) == end_or_sentinel(view->template segment<last_segment>());
       }
 
-      template <unsigned N>
-      auto tracking_info() const
+    private:
+      static constexpr size_t last_segment = number_of_segments - 1;
+
+      /**
+       * Calls `fn` with the index of the active segment as an integral constant.
+       */
+      template <typename Fn>
+      decltype(auto) dispatch(Fn&& fn) const
       {
-        return tracker.template get<N>();
+        return dispatch_impl(std::forward<Fn>(fn), indices{});
       }
 
-    private:
-      range_tracker<first_range_type, second_range_type> tracker;
+      template <typename Fn, size_t... Is>
+      decltype(auto) dispatch_impl(Fn&& fn, std::index_sequence<Is...>) const
+      {
+        using result_type = decltype(fn(std::integral_constant<size_t, 0>{}));
+        using function_type = result_type(*)(Fn&);
+        static constexpr function_type table[] = {
+          [](Fn& f) -> result_type { return f(std::integral_constant<size_t, Is>{}); }...
+        };
+        return table[current.index()](fn);
+      }
+
+      /**
+       * Moves to the beginning of the next non-empty segment, if the current one is exhausted.
+       */
+      template <size_t I>
+      void satisfy()
+      {
+        if constexpr (I < last_segment)
+        {
+          if (std::get<I>(current) == std::end(view->template segment<I>()))
+          {
+            current.template emplace<I + 1>(std::begin(view->template segment<I + 1>()));
+            satisfy<I + 1>();
+          }
+        }
+      }
+
+      View* view{nullptr};
+      storage_type current;
   };
 
   template <typename range_type>
@@ -492,10 +680,12 @@ namespace detail
       using orig_iterator = iterator_type_t<range_type>;
       using inner_iterator = decltype(std::begin(*std::declval<orig_iterator>()));
 
-      using value_type = typename inner_iterator::value_type;
-      using difference_type = typename inner_iterator::difference_type;
-      using pointer = typename inner_iterator::pointer;
-      using reference = typename inner_iterator::reference;
+      using _inner_traits = std::iterator_traits<inner_iterator>;
+
+      using value_type = typename _inner_traits::value_type;
+      using difference_type = typename _inner_traits::difference_type;
+      using pointer = typename _inner_traits::pointer;
+      using reference = typename _inner_traits::reference;
       using iterator_category = std::forward_iterator_tag;
 
       iterator_flattener(range_type& range)
@@ -643,6 +833,15 @@ namespace detail
         return *this;
       }
 
+      /**
+       * Requires random access iterators.
+       */
+      constexpr iterator_zipper& operator+=(difference_type distance)
+      {
+        tracker().advance_all(distance);
+        return *this;
+      }
+
       constexpr bool operator!=(const iterator_zipper& rhs) const
       {
         return has_next_helper(tracker(), rhs.tracker(), std::make_index_sequence<cardinality>());
@@ -769,6 +968,8 @@ namespace detail
 
   template <typename RangeType, typename Predicate>
   struct take_while_iterator
+    : compares_to_end_marker<take_while_iterator<RangeType, Predicate>>
+    , private functor_storage_t<Predicate, typename std::iterator_traits<iterator_type_t<RangeType>>::reference>
   {
     public:
       using _iter_traits = std::iterator_traits<iterator_type_t<RangeType>>;
@@ -778,20 +979,19 @@ namespace detail
       using reference = typename _iter_traits::reference;
       using iterator_category = std::forward_iterator_tag; // ??
 
-      explicit take_while_iterator(RangeType& range, Predicate p)
-        : tracker(range)
-        , predicate(std::move(p))
+      using predicate_handle = functor_storage_t<Predicate, reference>;
+
+      explicit take_while_iterator(RangeType& range, const Predicate& p)
+        : predicate_handle(p)
+        , tracker(range)
       {
-        const auto tracked = tracker.template get<0>();
-        const auto &it = tracked.first;
-        const auto &end = tracked.second;
-        if (it != end && !predicate(*it))
-          tracker.template set_to<0>(end);
+        if (tracker.template has_next<0>() && !predicate_handle::functor()(*tracker.template get<0>().first))
+          tracker.template set_to_end<0>();
       }
 
-      explicit take_while_iterator(RangeType& range, Predicate p, end_marker_t)
-        : tracker(range, end_marker_t{})
-        , predicate(std::move(p))
+      explicit take_while_iterator(RangeType& range, const Predicate& p, end_marker_t)
+        : predicate_handle(p)
+        , tracker(range, end_marker_t{})
       {
       }
 
@@ -799,12 +999,11 @@ namespace detail
       {
         tracker.template next<0>();
 
-        const auto tracked = tracker.template get<0>();
-        if (tracked.first == tracked.second)
+        if (!tracker.template has_next<0>())
           return *this;
 
-        if (!predicate(*tracked.first))
-          tracker.template set_to<0>(tracked.second);
+        if (!predicate_handle::functor()(*tracker.template get<0>().first))
+          tracker.template set_to_end<0>();
 
         return *this;
       }
@@ -824,13 +1023,17 @@ namespace detail
         return !(*this != rhs);
       }
 
+      bool is_end() const
+      {
+        return !tracker.template has_next<0>();
+      }
+
     private:
       range_tracker<RangeType> tracker;
-      Predicate predicate;
   };
 
   template <typename Range>
-  struct drop_iterator
+  struct drop_iterator : compares_to_end_marker<drop_iterator<Range>>
   {
     using _iter_traits = std::iterator_traits<iterator_type_t<Range>>;
     using difference_type = typename _iter_traits::difference_type;
@@ -881,6 +1084,11 @@ namespace detail
       return !(*this != rhs);
     }
 
+    constexpr bool is_end() const
+    {
+      return !tracker.template has_next<0>();
+    }
+
     range_tracker<Range> tracker;
   };
 
@@ -896,26 +1104,17 @@ namespace detail
       using reference = typename orig_iterator_traits::reference;
       using iterator_category = typename orig_iterator_traits::iterator_category;
 
-      constexpr explicit drop_while_iterator(Range& range, Predicate p)
+      constexpr explicit drop_while_iterator(Range& range, const Predicate& predicate)
         : tracker{range}
-        , predicate(std::move(p))
       {
-          while (ezy::invoke(predicate, *(tracker.template get<0>().first)))
+          while (tracker.template has_next<0>() && ezy::invoke(predicate, *(tracker.template get<0>().first)))
           {
-            if (tracker.template has_next<0>())
-            {
-              tracker.template next<0>();
-            }
-            else
-            {
-              return;
-            }
+            tracker.template next<0>();
           }
       }
 
-      constexpr explicit drop_while_iterator(Range& range, Predicate p, end_marker_t)
+      constexpr explicit drop_while_iterator(Range& range, const Predicate&, end_marker_t)
         : tracker{range, end_marker_t{}}
-        , predicate(std::move(p))
       {
       }
 
@@ -960,11 +1159,10 @@ namespace detail
 
     private:
       range_tracker<Range> tracker;
-      Predicate predicate;
   };
 
   template <typename Range>
-  struct step_by_iterator
+  struct step_by_iterator : compares_to_end_marker<step_by_iterator<Range>>
   {
     using _iter_traits = std::iterator_traits<iterator_type_t<Range>>;
     using difference_type = typename _iter_traits::difference_type;
@@ -1014,8 +1212,13 @@ namespace detail
       return !(*this != rhs);
     }
 
+    constexpr bool is_end() const
+    {
+      return !tracker.template has_next<0>();
+    }
+
     range_tracker<Range> tracker;
-    const size_type n{1};
+    size_type n{1};
   };
 
   /**
@@ -1033,6 +1236,21 @@ namespace detail
     const Range& orig_range;
   };
 
+  /**
+   * Internal iteration of const views calls their functors as const, so it is provided only for functors which
+   * can be called so. Others (eg. mutable lambdas) are called through the iterators, which own a copy of them.
+   */
+  template <typename F, typename Range, typename = void>
+  struct is_const_callable_on : std::false_type {};
+
+  template <typename F, typename Range>
+  struct is_const_callable_on<F, Range, void_t<decltype(*std::begin(std::declval<const Range&>()))>>
+    : std::is_invocable<const std::decay_t<F>&, decltype(*std::begin(std::declval<const Range&>()))>
+  {};
+
+  template <typename F, typename Range>
+  constexpr bool is_const_callable_on_v = is_const_callable_on<F, Range>::value;
+
   /**
    * range_view
    */
@@ -1050,10 +1268,68 @@ namespace detail
     constexpr const_iterator end() const
     { return const_iterator(std::cend(orig_range.get()), transformation); }
 
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr auto size() const
+    { return ezy::size(orig_range.get()); }
+
+    constexpr size_hint_t size_hint() const
+    { return detail::size_hint(orig_range.get()); }
+
+    template <typename Fn, typename T = Transformation, typename = std::enable_if_t<is_const_callable_on_v<T, Range>>>
+    constexpr bool for_each_until(Fn&& fn) const
+    {
+      return detail::for_each_until(std::as_const(orig_range.get()),
+          [&](auto&& element) { return fn(ezy::invoke(transformation, std::forward<decltype(element)>(element))); });
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_partitionable_v<R> && is_const_callable_on_v<Transformation, R>>>
+    constexpr size_t partition_extent() const
+    { return detail::partition_extent(orig_range.get()); }
+
+    template <typename Fn, typename T = Transformation, typename = std::enable_if_t<is_const_callable_on_v<T, Range>>>
+    constexpr bool for_each_until_in(size_t from, size_t until, Fn&& fn) const
+    {
+      return detail::for_each_until_in(std::as_const(orig_range.get()), from, until,
+          [&](auto&& element) { return fn(ezy::invoke(transformation, std::forward<decltype(element)>(element))); });
+    }
+
+    /**
+     * Adjacent transformations are fused into one view, see ezy::transform.
+     */
+    template <typename UnaryFunction>
+    constexpr auto then_transform(UnaryFunction&& fn) &&
+    {
+      using Fused = ezy::piped<Transformation, UnaryFunction>;
+      return range_view<Keeper, Fused>{
+        std::move(orig_range),
+        Fused(std::forward<Transformation>(transformation), std::forward<UnaryFunction>(fn))
+      };
+    }
+
     Keeper orig_range;
     Transformation transformation;
   };
 
+  /**
+   * predicate_conjunction holds when both predicates hold. The second one is called only if the first holds.
+   */
+  template <typename First, typename Second>
+  struct predicate_conjunction
+  {
+    template <typename T>
+    constexpr auto operator()(T&& t)
+      -> decltype(bool(ezy::invoke(std::declval<First&>(), t) && ezy::invoke(std::declval<Second&>(), t)))
+    { return ezy::invoke(first, t) && ezy::invoke(second, t); }
+
+    template <typename T>
+    constexpr auto operator()(T&& t) const
+      -> decltype(bool(ezy::invoke(std::declval<const First&>(), t) && ezy::invoke(std::declval<const Second&>(), t)))
+    { return ezy::invoke(first, t) && ezy::invoke(second, t); }
+
+    First first;
+    Second second;
+  };
+
   /**
    * range_view_filter
    */
@@ -1061,30 +1337,84 @@ namespace detail
   struct range_view_filter
   {
     using Range = ezy::experimental::keeper_value_type_t<Keeper>;
-    using const_iterator = iterator_filter<const_iterator_type_t<Range>, FilterPredicate>;
-    using iterator = iterator_filter<iterator_type_t<Range>, FilterPredicate>;
+    using const_iterator = iterator_filter<const range_view_filter, const_iterator_type_t<Range>>;
+    using iterator = iterator_filter<range_view_filter, iterator_type_t<Range>>;
     using size_type = size_type_t<Range>;
+    using predicate_type = FilterPredicate;
 
     range_view_filter(Keeper&& keeper, FilterPredicate pred)
       : orig_range(std::move(keeper))
       , predicate(pred)
     {}
 
+    /**
+     * Finding the first matching element may be expensive, so it is done once per view by the mutable begin().
+     * As for std::ranges::filter_view, const access does not cache (it is not synchronized), so const views can
+     * be iterated concurrently.
+     */
     const_iterator begin() const
-    { return const_iterator(std::begin(orig_range.get()), predicate, std::end(orig_range.get())); }
+    { return const_iterator(this, std::begin(orig_range.get())); }
 
     const_iterator end() const
-    { return const_iterator(std::end(orig_range.get()), predicate, std::end(orig_range.get())); }
+    { return const_iterator(this, std::end(orig_range.get())); }
 
     iterator begin()
-    { return iterator(std::begin(orig_range.get()), predicate, std::end(orig_range.get())); }
+    {
+      return cached_begin.get_or_emplace([this] {
+          return iterator(this, std::begin(orig_range.get()));
+      });
+    }
 
     iterator end()
-    { return iterator(std::end(orig_range.get()), predicate, std::end(orig_range.get())); }
+    { return iterator(this, std::end(orig_range.get())); }
+
+    template <typename Fn, typename P = FilterPredicate, typename = std::enable_if_t<is_const_callable_on_v<P, Range>>>
+    bool for_each_until(Fn&& fn) const
+    {
+      return detail::for_each_until(std::as_const(orig_range.get()),
+          [&](auto&& element) { return !predicate(element) || fn(element); });
+    }
+
+    template <typename Fn>
+    bool for_each_until(Fn&& fn)
+    {
+      return detail::for_each_until(orig_range.get(),
+          [&](auto&& element) { return !predicate(element) || fn(element); });
+    }
+
+    size_hint_t size_hint() const
+    { return at_most_hint(detail::size_hint(orig_range.get())); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_partitionable_v<R> && is_const_callable_on_v<FilterPredicate, R>>>
+    size_t partition_extent() const
+    { return detail::partition_extent(orig_range.get()); }
+
+    template <typename Fn, typename P = FilterPredicate, typename = std::enable_if_t<is_const_callable_on_v<P, Range>>>
+    bool for_each_until_in(size_t from, size_t until, Fn&& fn) const
+    {
+      return detail::for_each_until_in(std::as_const(orig_range.get()), from, until,
+          [&](auto&& element) { return !predicate(element) || fn(element); });
+    }
+
+    /**
+     * Adjacent filters are fused into one view, see ezy::filter.
+     */
+    template <typename Predicate>
+    auto and_filter(Predicate&& pred) &&
+    {
+      using Fused = predicate_conjunction<FilterPredicate, Predicate>;
+      return range_view_filter<Keeper, Fused>(
+          std::move(orig_range),
+          Fused{std::forward<FilterPredicate>(predicate), std::forward<Predicate>(pred)});
+    }
 
     private:
+      template <typename, typename>
+      friend struct iterator_filter;
+
       Keeper orig_range;
       FilterPredicate predicate;
+      non_propagating_cache<iterator> cached_begin;
   };
 
   /**
@@ -1110,32 +1440,99 @@ namespace detail
       }
 
       constexpr iterator begin()
-      { return iterator(std::next(std::begin(orig_range.get()), bounded(from))); }
+      { return bounds().first; }
 
       constexpr iterator end()
-      { return iterator(std::next(std::begin(orig_range.get()), bounded(until))); }
+      { return bounds().second; }
 
 
       constexpr const_iterator begin() const
-      { return const_iterator(std::next(std::begin(orig_range.get()), bounded(from))); }
+      { return bounds().first; }
 
       constexpr const_iterator end() const
-      { return const_iterator(std::next(std::begin(orig_range.get()), bounded(until))); }
+      { return bounds().second; }
+
+      template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+      constexpr size_type size() const
+      {
+        const auto range_size = static_cast<size_type>(ezy::size(orig_range.get()));
+        return std::min(range_size, until) - std::min(range_size, from);
+      }
+
+      template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+      constexpr auto data() const
+      {
+        const auto range_size = static_cast<size_type>(ezy::size(orig_range.get()));
+        return std::data(orig_range.get()) + std::min(range_size, from);
+      }
+
+      constexpr size_hint_t size_hint() const
+      { return drop_hint(take_hint(detail::size_hint(orig_range.get()), until), from); }
 
     private:
-      constexpr difference_type get_range_size() const
+      static constexpr bool is_random_access = does_range_iterator_implement_v<Range, std::random_access_iterator_tag>;
+
+      template <typename Iterator>
+      using bounds_cache_type = ezy::conditional_t<
+        is_random_access,
+        no_cache,
+        non_propagating_cache<std::pair<Iterator, Iterator>>
+      >;
+
+      /**
+       * Random access ranges are bounded in constant time on every call. Otherwise the range is walked only
+       * until `until` (never to its end), and the result is cached by non-const access, as `std::ranges` views
+       * do. Const access is not synchronized, so it does not cache.
+       */
+      template <typename RangeType>
+      static constexpr auto compute_bounds(RangeType& range, size_type from, size_type until)
+      {
+        using Iterator = decltype(std::begin(range));
+        const auto first = std::begin(range);
+        if constexpr (is_random_access)
+        {
+          const auto range_size = static_cast<size_type>(ezy::size(range));
+          return std::pair<Iterator, Iterator>(
+              std::next(first, std::min(range_size, from)),
+              std::next(first, std::min(range_size, until)));
+        }
+        else
+        {
+          const auto last = std::end(range);
+          const auto advance_bounded = [&last](Iterator it, size_type n)
+          {
+            for (; n > 0 && it != last; --n)
+              ++it;
+            return it;
+          };
+          const auto slice_first = advance_bounded(first, from);
+          return std::pair<Iterator, Iterator>(slice_first, advance_bounded(slice_first, until - from));
+        }
+      }
+
+      constexpr std::pair<iterator, iterator> bounds()
       {
-        return std::distance(std::begin(orig_range.get()), std::end(orig_range.get()));
+        if constexpr (is_random_access)
+        {
+          return compute_bounds(orig_range.get(), from, until);
+        }
+        else
+        {
+          if (!cached_bounds.has_value())
+            cached_bounds.emplace(compute_bounds(orig_range.get(), from, until));
+          return *cached_bounds;
+        }
       }
 
-      constexpr difference_type bounded(difference_type difference) const
+      constexpr std::pair<const_iterator, const_iterator> bounds() const
       {
-        return std::min(get_range_size(), difference);
+        return compute_bounds(std::as_const(orig_range.get()), from, until);
       }
 
       Keeper orig_range;
       const size_type from;
       const size_type until;
+      bounds_cache_type<iterator> cached_bounds;
   };
 
   template <typename Range>
@@ -1154,30 +1551,98 @@ namespace detail
     const difference_type group_size;
   };
 
-  // TODO generalize to N ranges (N > 0)
-  template <typename Keeper1, typename Keeper2>
+  template <typename... Keepers>
   struct concatenated_range_view
   {
     public:
-      using Range1 = ezy::experimental::keeper_value_type_t<Keeper1>;
-      using Range2 = ezy::experimental::keeper_value_type_t<Keeper2>;
-      using const_iterator = iterator_concatenator<
-        const Range1,
-        const Range2
+      static_assert(sizeof...(Keepers) > 0, "At least one range is needed");
+
+      template <bool Const>
+      using segments_type = std::tuple<
+        ezy::conditional_t<Const,
+          const ezy::experimental::keeper_value_type_t<Keepers>&,
+          ezy::experimental::keeper_value_type_t<Keepers>&
+        >...
       >;
+
+      using iterator = iterator_concatenator<concatenated_range_view>;
+      using const_iterator = iterator_concatenator<const concatenated_range_view>;
       using difference_type = typename const_iterator::difference_type;
-      using size_type = size_type_t<Range1>;
+      using size_type = size_type_t<ezy::experimental::keeper_value_type_t<std::tuple_element_t<0, std::tuple<Keepers...>>>>;
+
+      constexpr explicit concatenated_range_view(Keepers&&... ks)
+        : keepers(std::move(ks)...)
+      {}
+
+      iterator begin()
+      { return iterator(*this); }
+
+      iterator end()
+      { return iterator(*this, end_marker_t{}); }
 
       const_iterator begin() const
-      { return const_iterator(range1.get(), range2.get()); }
+      { return const_iterator(*this); }
 
       const_iterator end() const
-      { return const_iterator(range1.get(), range2.get(), end_marker_t{}); }
+      { return const_iterator(*this, end_marker_t{}); }
 
-    public:
-    //private:
-      Keeper1 range1;
-      Keeper2 range2;
+      constexpr end_marker_t sentinel() const
+      { return {}; }
+
+      template <bool Enabled = true,
+               typename = std::enable_if_t<Enabled && (is_sized_range_v<ezy::experimental::keeper_value_type_t<Keepers>> && ...)>>
+      constexpr size_type size() const
+      {
+        return std::apply(
+            [](const auto&... ks) { return (size_type{0} + ... + static_cast<size_type>(ezy::size(ks.get()))); },
+            keepers);
+      }
+
+      constexpr size_hint_t size_hint() const
+      {
+        return std::apply(
+            [](const auto&... ks) {
+              auto hint = size_hint_t::exact(0);
+              ((hint = sum_hints(hint, detail::size_hint(ks.get()))), ...);
+              return hint;
+            },
+            keepers);
+      }
+
+      template <size_t I>
+      constexpr decltype(auto) segment()
+      { return std::get<I>(keepers).get(); }
+
+      template <size_t I>
+      constexpr decltype(auto) segment() const
+      { return std::as_const(std::get<I>(keepers).get()); }
+
+      template <typename Fn>
+      bool for_each_until(Fn&& fn) const
+      {
+        return for_each_segment_until(fn, std::index_sequence_for<Keepers...>{});
+      }
+
+      template <typename Fn>
+      bool for_each_until(Fn&& fn)
+      {
+        return for_each_segment_until(fn, std::index_sequence_for<Keepers...>{});
+      }
+
+    private:
+      template <typename Fn, size_t... Is>
+      bool for_each_segment_until(Fn& fn, std::index_sequence<Is...>) const
+      {
+        return (detail::for_each_until(segment<Is>(), fn) && ...);
+      }
+
+      template <typename Fn, size_t... Is>
+      bool for_each_segment_until(Fn& fn, std::index_sequence<Is...>)
+      {
+        return (detail::for_each_until(segment<Is>(), fn) && ...);
+      }
+
+      std::tuple<Keepers...> keepers;
   };
 
   template <typename Zipper, typename... Keepers>
@@ -1270,12 +1735,80 @@ namespace detail
       constexpr iterator end()
       { return get_end(zipper, keepers); }
 
-    public:
+      template <bool Enabled = true,
+               typename = std::enable_if_t<Enabled && (is_sized_range_v<ezy::experimental::keeper_value_type_t<Keepers>> && ...)>>
+      constexpr size_type size() const
+      {
+        return std::apply(
+            [](const auto&... ks) { return std::min({static_cast<size_type>(ezy::size(ks.get()))...}); },
+            keepers);
+      }
+
+      constexpr size_hint_t size_hint() const
+      {
+        return std::apply(
+            [](const auto&... ks) {
+              auto hint = size_hint_t{std::numeric_limits<size_t>::max(), std::nullopt};
+              ((hint = min_hints(hint, detail::size_hint(ks.get()))), ...);
+              return hint;
+            },
+            keepers);
+      }
+
+      template <bool Enabled = true,
+               typename = std::enable_if_t<Enabled && (is_partitionable_v<ezy::experimental::keeper_value_type_t<Keepers>> && ...)
+                 && (does_range_iterator_implement_v<ezy::experimental::keeper_value_type_t<Keepers>, std::random_access_iterator_tag> && ...)>>
+      constexpr size_type partition_extent() const
+      { return size(); }
+
+      template <typename Fn>
+      bool for_each_until_in(size_t from, size_t until, Fn&& fn) const
+      {
+        auto it = begin();
+        it += from;
+        for (; from != until; ++from, ++it)
+        {
+          if (!fn(*it))
+            return false;
+        }
+        return true;
+      }
+
+    public:
     //private:
       Zipper zipper;
       KeepersTuple keepers;
   };
 
+  /**
+   * Number of elements of ranges whose size is part of their type (arrays).
+   */
+  template <typename T>
+  struct static_extent
+  {};
+
+  template <typename T, size_t N>
+  struct static_extent<T[N]> : std::integral_constant<size_t, N>
+  {};
+
+  template <typename T, size_t N>
+  struct static_extent<std::array<T, N>> : std::integral_constant<size_t, N>
+  {};
+
+  template <typename T, typename = void>
+  struct has_static_extent : std::false_type
+  {};
+
+  template <typename T>
+  struct has_static_extent<T, std::void_t<decltype(static_extent<T>::value)>> : std::true_type
+  {};
+
+  template <typename T>
+  constexpr bool has_static_extent_v = has_static_extent<T>::value;
+
+  template <typename T>
+  constexpr size_t static_extent_v = static_extent<T>::value;
+
   template <typename Keeper>
   struct flattened_range_view
   {
@@ -1307,6 +1840,41 @@ namespace detail
         return iterator(range.get(), end_marker_t{});
       }
 
+      /**
+       * The outer range is not traversed for the hint (it may compute its elements), so the hint is known only if
+       * the subranges have a size fixed by their type (eg. std::array).
+       */
+      size_hint_t size_hint() const
+      {
+        using Subrange = ezy::remove_cvref_t<value_type_t<const Range&>>;
+        if constexpr (is_sized_range_v<Range> && has_static_extent_v<Subrange>)
+          return size_hint_t::exact(static_cast<size_t>(ezy::size(range.get())) * static_extent_v<Subrange>);
+        else
+          return {};
+      }
+
+      template <typename Fn>
+      bool for_each_until(Fn&& fn) const
+      {
+        for (const auto& subrange : range.get())
+        {
+          if (!detail::for_each_until(subrange, fn))
+            return false;
+        }
+        return true;
+      }
+
+      template <typename Fn>
+      bool for_each_until(Fn&& fn)
+      {
+        for (auto&& subrange : range.get())
+        {
+          if (!detail::for_each_until(subrange, fn))
+            return false;
+        }
+        return true;
+      }
+
     //private:
       Keeper range;
   };
@@ -1341,8 +1909,99 @@ namespace detail
         return const_iterator(range.get(), end_marker_t{});
       }
 
+      template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+      constexpr size_type size() const
+      {
+        return std::min(static_cast<size_type>(ezy::size(range.get())), n);
+      }
+
+      template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+      constexpr auto data() const
+      {
+        return std::data(range.get());
+      }
+
+      constexpr size_hint_t size_hint() const
+      {
+        return take_hint(detail::size_hint(range.get()), n);
+      }
+
+      /**
+       * The count is checked in the loop body of the underlying range, so a take at the end of a pipeline does
+       * not wrap the iterators of the previous stages.
+       */
+      template <typename Fn>
+      constexpr bool for_each_until(Fn&& fn) const
+      {
+        return for_each_until_taken(std::as_const(range.get()), n, fn);
+      }
+
+      template <typename Fn>
+      constexpr bool for_each_until(Fn&& fn)
+      {
+        return for_each_until_taken(range.get(), n, fn);
+      }
+
       Keeper range;
       size_type n;
+
+    private:
+      template <typename R, typename Fn>
+      static constexpr bool for_each_until_taken(R& r, size_type n, Fn& fn)
+      {
+        if (n == 0)
+          return true;
+
+        size_type remaining = n;
+        bool stopped = false;
+        detail::for_each_until(r, [&](auto&& element) {
+            if (!fn(std::forward<decltype(element)>(element)))
+            {
+              stopped = true;
+              return false;
+            }
+            return --remaining != 0;
+        });
+        return !stopped;
+      }
+  };
+
+  /**
+   * take over random access ranges: the end is reached by a single clamped jump, and the iterators of the range
+   * are used as they are, so infinite random access ranges (eg. cycle) are sized after take.
+   */
+  template <typename Keeper>
+  struct random_access_take_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = const_iterator_type_t<Range>;
+    using iterator = iterator_type_t<Range>;
+    using size_type = size_type_t<Range>;
+
+    constexpr const_iterator begin() const
+    { return std::begin(range.get()); }
+
+    constexpr const_iterator end() const
+    { return std::next(begin(), static_cast<std::ptrdiff_t>(size())); }
+
+    constexpr iterator begin()
+    { return std::begin(range.get()); }
+
+    constexpr iterator end()
+    { return std::next(begin(), static_cast<std::ptrdiff_t>(size())); }
+
+    constexpr size_type size() const
+    {
+      const auto available = static_cast<size_type>(std::end(range.get()) - std::begin(range.get()));
+      return std::min(available, n);
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+    constexpr auto data() const
+    { return std::data(range.get()); }
+
+    Keeper range;
+    size_type n;
   };
 
   template <typename Keeper>
@@ -1353,6 +2012,9 @@ namespace detail
     using iterator = drop_iterator<Range>;
     using size_type = size_type_t<Range>;
 
+    /**
+     * The dropped prefix is walked once per view by the mutable begin(), see range_view_filter.
+     */
     constexpr const_iterator begin() const
     {
       return const_iterator(range.get(), n);
@@ -1365,7 +2027,7 @@ namespace detail
 
     constexpr iterator begin()
     {
-      return iterator(range.get(), n);
+      return cached_begin.get_or_emplace([this] { return iterator(range.get(), n); });
     }
 
     constexpr iterator end()
@@ -1373,8 +2035,72 @@ namespace detail
       return iterator(range.get(), end_marker_t{});
     }
 
+    constexpr end_marker_t sentinel() const
+    {
+      return {};
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(range.get()));
+      return range_size > n ? range_size - n : size_type{0};
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+    constexpr auto data() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(range.get()));
+      return std::data(range.get()) + std::min(range_size, n);
+    }
+
+    constexpr size_hint_t size_hint() const
+    {
+      return drop_hint(detail::size_hint(range.get()), n);
+    }
+
+    Keeper range;
+    const size_type n;
+    non_propagating_cache<iterator> cached_begin{};
+  };
+
+  /**
+   * drop over sized random access ranges: the first element is reached by a single clamped jump, and the
+   * iterators of the range are used as they are.
+   */
+  template <typename Keeper>
+  struct random_access_drop_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = const_iterator_type_t<Range>;
+    using iterator = iterator_type_t<Range>;
+    using size_type = size_type_t<Range>;
+
+    constexpr const_iterator begin() const
+    { return std::next(std::begin(range.get()), static_cast<std::ptrdiff_t>(offset())); }
+
+    constexpr const_iterator end() const
+    { return std::end(range.get()); }
+
+    constexpr iterator begin()
+    { return std::next(std::begin(range.get()), static_cast<std::ptrdiff_t>(offset())); }
+
+    constexpr iterator end()
+    { return std::end(range.get()); }
+
+    constexpr size_type size() const
+    { return static_cast<size_type>(ezy::size(range.get())) - offset(); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+    constexpr auto data() const
+    { return std::data(range.get()) + offset(); }
+
     Keeper range;
     const size_type n;
+
+    private:
+      constexpr size_type offset() const
+      { return std::min(static_cast<size_type>(ezy::size(range.get())), n); }
   };
 
   template <typename Keeper>
@@ -1405,10 +2131,197 @@ namespace detail
       return iterator(keeper.get(), end_marker_t{});
     }
 
+    constexpr end_marker_t sentinel() const
+    {
+      return {};
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return (range_size + n - 1) / n;
+    }
+
+    constexpr size_hint_t size_hint() const
+    {
+      return ceil_div_hint(detail::size_hint(keeper.get()), n);
+    }
+
+    Keeper keeper;
+    size_type n{1};
+  };
+
+  /**
+   * strided_iterator visits every `stride`th element from `base` by random access. Positions are computed from
+   * the index on dereferencing, so no iterator past the end of the underlying range is formed.
+   */
+  template <typename Iterator>
+  struct strided_iterator
+  {
+    using _iter_traits = std::iterator_traits<Iterator>;
+    using difference_type = typename _iter_traits::difference_type;
+    using value_type = typename _iter_traits::value_type;
+    using pointer = typename _iter_traits::pointer;
+    using reference = typename _iter_traits::reference;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr strided_iterator() = default;
+
+    constexpr strided_iterator(Iterator base, difference_type stride, difference_type index)
+      : base(base)
+      , stride(stride)
+      , index(index)
+    {}
+
+    constexpr reference operator*() const
+    { return base[index * stride]; }
+
+    constexpr reference operator[](difference_type n) const
+    { return base[(index + n) * stride]; }
+
+    constexpr strided_iterator& operator++()
+    {
+      ++index;
+      return *this;
+    }
+
+    constexpr strided_iterator operator++(int)
+    {
+      auto result = *this;
+      ++index;
+      return result;
+    }
+
+    constexpr strided_iterator& operator--()
+    {
+      --index;
+      return *this;
+    }
+
+    constexpr strided_iterator operator--(int)
+    {
+      auto result = *this;
+      --index;
+      return result;
+    }
+
+    constexpr strided_iterator& operator+=(difference_type n)
+    {
+      index += n;
+      return *this;
+    }
+
+    constexpr strided_iterator& operator-=(difference_type n)
+    {
+      index -= n;
+      return *this;
+    }
+
+    friend constexpr strided_iterator operator+(strided_iterator it, difference_type n)
+    { return it += n; }
+
+    friend constexpr strided_iterator operator+(difference_type n, strided_iterator it)
+    { return it += n; }
+
+    friend constexpr strided_iterator operator-(strided_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index - rhs.index; }
+
+    friend constexpr bool operator==(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index == rhs.index; }
+
+    friend constexpr bool operator!=(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index != rhs.index; }
+
+    friend constexpr bool operator<(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index < rhs.index; }
+
+    friend constexpr bool operator>(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index > rhs.index; }
+
+    friend constexpr bool operator<=(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index <= rhs.index; }
+
+    friend constexpr bool operator>=(const strided_iterator& lhs, const strided_iterator& rhs)
+    { return lhs.index >= rhs.index; }
+
+    private:
+      Iterator base{};
+      difference_type stride{1};
+      difference_type index{0};
+  };
+
+  /**
+   * step_by over sized random access ranges: O(1) steps, closed form size and indexing.
+   */
+  template <typename Keeper>
+  struct random_access_step_by_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = strided_iterator<const_iterator_type_t<Range>>;
+    using iterator = strided_iterator<iterator_type_t<Range>>;
+    using size_type = size_type_t<Range>;
+
+    constexpr const_iterator begin() const
+    { return const_iterator(std::begin(keeper.get()), static_cast<std::ptrdiff_t>(n), 0); }
+
+    constexpr const_iterator end() const
+    { return begin() + static_cast<std::ptrdiff_t>(size()); }
+
+    constexpr iterator begin()
+    { return iterator(std::begin(keeper.get()), static_cast<std::ptrdiff_t>(n), 0); }
+
+    constexpr iterator end()
+    { return begin() + static_cast<std::ptrdiff_t>(size()); }
+
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return (range_size + n - 1) / n;
+    }
+
+    constexpr decltype(auto) operator[](size_type index) const
+    { return begin()[static_cast<std::ptrdiff_t>(index)]; }
+
     Keeper keeper;
     size_type n{1};
   };
 
+  /**
+   * strided_view: `count` elements from `base`, every `stride`th one (eg. a column of a row-major matrix). It
+   * does not own the elements.
+   */
+  template <typename Iterator>
+  struct strided_view
+  {
+    using iterator = strided_iterator<Iterator>;
+    using const_iterator = iterator;
+    using size_type = size_t;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    constexpr iterator begin() const
+    { return iterator(base, stride, 0); }
+
+    constexpr iterator end() const
+    { return iterator(base, stride, static_cast<difference_type>(count)); }
+
+    constexpr size_type size() const
+    { return count; }
+
+    constexpr bool empty() const
+    { return count == 0; }
+
+    constexpr decltype(auto) operator[](size_type index) const
+    { return begin()[static_cast<difference_type>(index)]; }
+
+    Iterator base;
+    difference_type stride;
+    size_type count;
+  };
+
   template <typename Keeper, typename Predicate>
   struct take_while_range_view
   {
@@ -1438,8 +2351,48 @@ namespace detail
         return const_iterator(range.get(), pred, end_marker_t{});
       }
 
+      constexpr end_marker_t sentinel() const
+      {
+        return {};
+      }
+
+      constexpr size_hint_t size_hint() const
+      {
+        return at_most_hint(detail::size_hint(range.get()));
+      }
+
+      template <typename Fn, typename P = Predicate, typename = std::enable_if_t<is_const_callable_on_v<P, Range>>>
+      bool for_each_until(Fn&& fn) const
+      {
+        return for_each_until_holds(std::as_const(range.get()), pred, fn);
+      }
+
+      template <typename Fn>
+      bool for_each_until(Fn&& fn)
+      {
+        return for_each_until_holds(range.get(), pred, fn);
+      }
+
       Keeper range;
       Predicate pred;
+
+    private:
+      template <typename R, typename P, typename Fn>
+      static bool for_each_until_holds(R& r, P& p, Fn& fn)
+      {
+        bool stopped = false;
+        detail::for_each_until(r, [&](auto&& element) {
+            if (!ezy::invoke(p, element))
+              return false;
+            if (!fn(std::forward<decltype(element)>(element)))
+            {
+              stopped = true;
+              return false;
+            }
+            return true;
+        });
+        return !stopped;
+      }
   };
 
   template <typename Keeper, typename Predicate>
@@ -1451,9 +2404,12 @@ namespace detail
       using const_iterator = drop_while_iterator<const Range, Predicate>;
       using size_type = size_type_t<Range>;
 
+      /**
+       * The dropped prefix is walked once per view by the mutable begin(), see range_view_filter.
+       */
       constexpr iterator begin()
       {
-        return iterator(range.get(), pred);
+        return cached_begin.get_or_emplace([this] { return iterator(range.get(), pred); });
       }
 
       constexpr iterator end()
@@ -1471,47 +2427,121 @@ namespace detail
         return const_iterator(range.get(), pred, end_marker_t{});
       }
 
+      constexpr size_hint_t size_hint() const
+      {
+        return at_most_hint(detail::size_hint(range.get()));
+      }
+
       Keeper range;
       Predicate pred;
+      non_propagating_cache<iterator> cached_begin{};
   };
 
-  template <typename T, typename Operation>
-  struct iterate_iterator
+  /**
+   * partitioned_range_view: the part of the range before (`Prefix`) or after the first element for which the
+   * predicate does not hold. The predicate must be monotonic (eg. `< limit` on a sorted range), so the cut is
+   * found by binary search: O(log n) predicate calls, and O(log n) steps for random access ranges. The cut is
+   * cached by non-const access, see range_view_filter.
+   */
+  template <typename Keeper, typename Predicate, bool Prefix>
+  struct partitioned_range_view
   {
-    using difference_type = std::ptrdiff_t;
-    using value_type = T;
-    using reference = std::add_lvalue_reference_t<T>;
-    using const_reference = std::add_lvalue_reference_t<std::add_const_t<T>>;
-    using pointer = std::add_pointer_t<T>;
-    using iterator_category = std::forward_iterator_tag;
-
-    constexpr explicit iterate_iterator(T init, Operation op)
-      : storage(init, op)
-    {}
-
-    constexpr iterate_iterator(const iterate_iterator& rhs)
-      : storage(rhs.storage)
-    {}
+    public:
+      using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+      using iterator = iterator_type_t<Range>;
+      using const_iterator = const_iterator_type_t<Range>;
+      using size_type = size_type_t<Range>;
 
-    constexpr iterate_iterator& operator=(const iterate_iterator& rhs)
-    {
-      storage = rhs.storage;
-      return *this;
-    }
+      constexpr iterator begin()
+      {
+        if constexpr (Prefix)
+          return std::begin(range.get());
+        else
+          return cut();
+      }
+
+      constexpr iterator end()
+      {
+        if constexpr (Prefix)
+          return cut();
+        else
+          return std::end(range.get());
+      }
+
+      constexpr const_iterator begin() const
+      {
+        if constexpr (Prefix)
+          return std::begin(range.get());
+        else
+          return cut();
+      }
+
+      constexpr const_iterator end() const
+      {
+        if constexpr (Prefix)
+          return cut();
+        else
+          return std::end(range.get());
+      }
+
+      template <typename R = Range, typename = std::enable_if_t<does_range_iterator_implement_v<R, std::random_access_iterator_tag>>>
+      constexpr size_type size() const
+      { return static_cast<size_type>(end() - begin()); }
+
+      template <typename R = Range, typename = std::enable_if_t<is_contiguous_range_v<R>>>
+      constexpr auto data() const
+      { return std::data(range.get()) + (begin() - std::begin(range.get())); }
+
+      constexpr size_hint_t size_hint() const
+      { return at_most_hint(detail::size_hint(range.get())); }
+
+      Keeper range;
+      Predicate pred;
+      non_propagating_cache<iterator> cached_cut{};
+
+    private:
+      constexpr iterator cut()
+      {
+        return cached_cut.get_or_emplace([this] {
+            return std::partition_point(std::begin(range.get()), std::end(range.get()), std::ref(pred));
+          });
+      }
+
+      constexpr const_iterator cut() const
+      {
+        return std::partition_point(std::begin(range.get()), std::end(range.get()), std::cref(pred));
+      }
+  };
+
+  template <typename T, typename Operation>
+  struct iterate_iterator : private functor_storage_t<ezy::remove_cvref_t<Operation>, std::remove_const_t<T>&>
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = std::add_lvalue_reference_t<T>;
+    using const_reference = std::add_lvalue_reference_t<std::add_const_t<T>>;
+    using pointer = std::add_pointer_t<T>;
+    using iterator_category = std::forward_iterator_tag;
+    using operation_handle = functor_storage_t<ezy::remove_cvref_t<Operation>, std::remove_const_t<T>&>;
+
+    constexpr explicit iterate_iterator(T init, const ezy::remove_cvref_t<Operation>& op)
+      : operation_handle(op)
+      , current(init)
+    {}
 
     constexpr reference operator*() noexcept
     {
-      return std::get<0>(storage);
+      return current;
     }
 
     constexpr const_reference operator*() const noexcept
     {
-      return std::get<0>(storage);
+      return current;
     }
 
     constexpr bool operator!=(const iterate_iterator& rhs) const noexcept
     {
-      return std::get<0>(storage) != std::get<0>(rhs.storage);
+      return current != rhs.current;
     }
     constexpr bool operator==(const iterate_iterator& rhs) const noexcept
     {
@@ -1520,11 +2550,11 @@ namespace detail
 
     constexpr iterate_iterator& operator++()
     {
-      std::get<0>(storage) = ezy::invoke(std::get<1>(storage), std::get<0>(storage));
+      current = ezy::invoke(operation_handle::functor(), current);
       return *this;
     }
 
-    std::tuple<std::remove_const_t<T>, ezy::remove_cvref_t<Operation>> storage;
+    std::remove_const_t<T> current;
   };
 
   template <typename T, typename Operation>
@@ -1549,8 +2579,223 @@ namespace detail
     ezy::remove_cvref_t<Operation> op;
   };
 
+  /**
+   * Step of iota views counting one by one.
+   */
+  struct unit_step
+  {};
+
+  /**
+   * iota_iterator: the `index`th element is `from + index * step`, computed in closed form, so the iterator is
+   * random access and a loop over it is a counted loop.
+   *
+   * Integers counted one by one are stored as the current value itself (and `index` is unused), so the loop
+   * variable is the element, as in a hand-written loop.
+   */
+  template <typename T, typename Step>
+  struct iota_iterator
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = T;
+    using pointer = arrow_proxy<T>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    static constexpr bool counts_value = std::is_integral_v<T> && std::is_same_v<Step, unit_step>;
+
+    constexpr iota_iterator() = default;
+
+    constexpr iota_iterator(const T& from, const Step& step, difference_type index)
+      : from(counts_value ? static_cast<T>(from + index) : from)
+      , step(step)
+      , index(counts_value ? 0 : index)
+    {}
+
+    constexpr reference operator*() const
+    { return at(0); }
+
+    constexpr pointer operator->() const
+    { return pointer{at(0)}; }
+
+    constexpr reference operator[](difference_type n) const
+    { return at(n); }
+
+    constexpr iota_iterator& operator++()
+    {
+      if constexpr (counts_value)
+        ++from;
+      else
+        ++index;
+      return *this;
+    }
+
+    constexpr iota_iterator operator++(int)
+    {
+      auto result = *this;
+      ++(*this);
+      return result;
+    }
+
+    constexpr iota_iterator& operator--()
+    {
+      if constexpr (counts_value)
+        --from;
+      else
+        --index;
+      return *this;
+    }
+
+    constexpr iota_iterator operator--(int)
+    {
+      auto result = *this;
+      --(*this);
+      return result;
+    }
+
+    constexpr iota_iterator& operator+=(difference_type n)
+    {
+      if constexpr (counts_value)
+        from += static_cast<T>(n);
+      else
+        index += n;
+      return *this;
+    }
+
+    constexpr iota_iterator& operator-=(difference_type n)
+    { return *this += -n; }
+
+    friend constexpr iota_iterator operator+(iota_iterator it, difference_type n)
+    { return it += n; }
+
+    friend constexpr iota_iterator operator+(difference_type n, iota_iterator it)
+    { return it += n; }
+
+    friend constexpr iota_iterator operator-(iota_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() - rhs.position(); }
+
+    friend constexpr bool operator==(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() == rhs.position(); }
+
+    friend constexpr bool operator!=(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() != rhs.position(); }
+
+    friend constexpr bool operator<(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() < rhs.position(); }
+
+    friend constexpr bool operator>(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() > rhs.position(); }
+
+    friend constexpr bool operator<=(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() <= rhs.position(); }
+
+    friend constexpr bool operator>=(const iota_iterator& lhs, const iota_iterator& rhs)
+    { return lhs.position() >= rhs.position(); }
+
+    private:
+      constexpr T at(difference_type n) const
+      {
+        if constexpr (counts_value)
+          return static_cast<T>(from + n);
+        else if constexpr (std::is_same_v<Step, unit_step>)
+          return static_cast<T>(from + (index + n));
+        else
+          return static_cast<T>(from + (index + n) * step);
+      }
+
+      constexpr difference_type position() const
+      {
+        if constexpr (counts_value)
+          return static_cast<difference_type>(from);
+        else
+          return index;
+      }
+
+      T from{};
+      Step step{};
+      difference_type index{0};
+  };
+
+  /**
+   * iota_view: `count` elements, from `from` increased by `step` (or by one).
+   */
+  template <typename T, typename Step = unit_step>
+  struct iota_view
+  {
+    using iterator = iota_iterator<T, Step>;
+    using const_iterator = iterator;
+    using size_type = size_t;
+
+    constexpr const_iterator begin() const
+    { return const_iterator(from, step, 0); }
+
+    constexpr const_iterator end() const
+    { return const_iterator(from, step, static_cast<std::ptrdiff_t>(count)); }
+
+    constexpr size_type size() const
+    { return count; }
+
+    constexpr bool empty() const
+    { return count == 0; }
+
+    template <typename Fn>
+    constexpr bool for_each_until(Fn&& fn) const
+    {
+      for (auto it = begin(), last = end(); it != last; ++it)
+      {
+        if (!fn(*it))
+          return false;
+      }
+      return true;
+    }
+
+    T from{};
+    Step step{};
+    size_type count{0};
+  };
+
+  /**
+   * Number of steps from `from` (inclusive) to `until` (exclusive), or 0 if `until` is in the opposite
+   * direction. `step` must not be 0. Distances of integers are computed unsigned, so they do not overflow near
+   * the limits of the type.
+   */
+  template <typename T, typename Step>
+  constexpr size_t steps_between(const T& from, const T& until, const Step& step)
+  {
+    if constexpr (std::is_floating_point_v<T> || std::is_floating_point_v<Step>)
+    {
+      const auto steps = (until - from) / step;
+      if (!(steps > 0))
+        return 0;
+      const auto whole = static_cast<size_t>(steps);
+      return static_cast<double>(whole) < steps ? whole + 1 : whole;
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_integral_v<Step>)
+    {
+      assert(step != 0);
+      using U = std::make_unsigned_t<std::common_type_t<T, Step>>;
+      const auto distance = [](const T& lower, const T& upper) {
+        return static_cast<U>(static_cast<U>(upper) - static_cast<U>(lower));
+      };
+      if (step > 0)
+        return from < until ? static_cast<size_t>((distance(from, until) - 1) / static_cast<U>(step) + 1) : 0;
+      else
+        return until < from ? static_cast<size_t>((distance(until, from) - 1) / static_cast<U>(U{0} - static_cast<U>(step)) + 1) : 0;
+    }
+    else
+    {
+      assert(step != Step{0});
+      if (step > 0)
+        return from < until ? static_cast<size_t>((until - from - 1) / step + 1) : 0;
+      else
+        return until < from ? static_cast<size_t>((from - until - 1) / -step + 1) : 0;
+    }
+  }
+
   template <typename Range>
-  struct cycle_iterator
+  struct cycle_iterator : compares_to_end_marker<cycle_iterator<Range>>
   {
     using orig_traits = std::iterator_traits<iterator_type_t<Range>>;
     using difference_type = typename orig_traits::difference_type;
@@ -1559,6 +2804,10 @@ namespace detail
     using reference = typename orig_traits::reference;
     using iterator_category = std::forward_iterator_tag;
 
+    explicit cycle_iterator(Range& range)
+      : tracker(range)
+    {}
+
     decltype(auto) operator*()
     {
       return *(tracker.template get<0>().first);
@@ -1579,6 +2828,11 @@ namespace detail
       return true;
     }
 
+    constexpr bool is_end() const
+    {
+      return false;
+    }
+
     range_tracker<Range> tracker;
   };
 
@@ -1605,188 +2859,1705 @@ namespace detail
     const_iterator end() const
     { return const_iterator{range.get()}; }
 
+    constexpr end_marker_t sentinel() const
+    { return {}; }
+
     Keeper range;
   };
 
-  template <typename T>
-  struct repeat_iterator
+  /**
+   * cycle over sized random access ranges: the position in the range is the index modulo the size of the
+   * range. Stepping wraps around without division, jumps use a precomputed fast_modulo.
+   */
+  template <typename Iterator>
+  struct random_access_cycle_iterator : compares_to_end_marker<random_access_cycle_iterator<Iterator>>
   {
-    using size_type = std::size_t;
-    using difference_type = std::ptrdiff_t;
-    using value_type = T;
-    using pointer = T*;
-    using reference = T&;
-    using iterator_category = std::forward_iterator_tag; // random_access
+    using orig_traits = std::iterator_traits<Iterator>;
+    using difference_type = typename orig_traits::difference_type;
+    using value_type = typename orig_traits::value_type;
+    using pointer = typename orig_traits::pointer;
+    using reference = typename orig_traits::reference;
+    using iterator_category = std::random_access_iterator_tag;
 
-    decltype(auto) operator*()
+    constexpr random_access_cycle_iterator() = default;
+
+    constexpr random_access_cycle_iterator(Iterator base, fast_modulo modulo, difference_type index)
+      : base(base)
+      , modulo(modulo)
+      , index(index)
+      , offset(offset_of(index))
+    {}
+
+    constexpr reference operator*() const
+    { return base[static_cast<difference_type>(offset)]; }
+
+    constexpr reference operator[](difference_type n) const
+    { return base[static_cast<difference_type>(offset_of(index + n))]; }
+
+    constexpr random_access_cycle_iterator& operator++()
     {
-      return t;
+      ++index;
+      if (++offset == modulo.divisor)
+        offset = 0;
+      return *this;
     }
 
-    decltype(auto) operator*() const
+    constexpr random_access_cycle_iterator operator++(int)
     {
-      return t;
+      auto result = *this;
+      ++*this;
+      return result;
     }
 
-    repeat_iterator& operator++()
+    constexpr random_access_cycle_iterator& operator--()
     {
+      --index;
+      if (offset == 0)
+        offset = modulo.divisor;
+      --offset;
       return *this;
     }
 
-    bool operator!=(const repeat_iterator&) const
+    constexpr random_access_cycle_iterator operator--(int)
     {
-      return true;
+      auto result = *this;
+      --*this;
+      return result;
     }
 
-    T t;
+    constexpr random_access_cycle_iterator& operator+=(difference_type n)
+    {
+      index += n;
+      offset = offset_of(index);
+      return *this;
+    }
+
+    constexpr random_access_cycle_iterator& operator-=(difference_type n)
+    { return *this += -n; }
+
+    friend constexpr random_access_cycle_iterator operator+(random_access_cycle_iterator it, difference_type n)
+    { return it += n; }
+
+    friend constexpr random_access_cycle_iterator operator+(difference_type n, random_access_cycle_iterator it)
+    { return it += n; }
+
+    friend constexpr random_access_cycle_iterator operator-(random_access_cycle_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index - rhs.index; }
+
+    friend constexpr bool operator==(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index == rhs.index; }
+
+    friend constexpr bool operator!=(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index != rhs.index; }
+
+    friend constexpr bool operator<(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index < rhs.index; }
+
+    friend constexpr bool operator>(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index > rhs.index; }
+
+    friend constexpr bool operator<=(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index <= rhs.index; }
+
+    friend constexpr bool operator>=(const random_access_cycle_iterator& lhs, const random_access_cycle_iterator& rhs)
+    { return lhs.index >= rhs.index; }
+
+    constexpr bool is_end() const
+    { return index == unreachable; }
+
+    static constexpr difference_type unreachable = std::numeric_limits<difference_type>::max();
+
+    private:
+      constexpr size_t offset_of(difference_type i) const
+      {
+        if (i >= 0)
+          return modulo(static_cast<size_t>(i));
+
+        const auto remainder = modulo(static_cast<size_t>(-(i + 1)));
+        return modulo.divisor - 1 - remainder;
+      }
+
+      Iterator base{};
+      fast_modulo modulo{1};
+      difference_type index{0};
+      size_t offset{0};
   };
 
-  template <typename T>
-  struct repeat_view
+  template <typename Keeper>
+  struct random_access_cycle_view
   {
-    using iterator = repeat_iterator<T>;
-    using const_iterator = repeat_iterator<T>;
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using iterator = random_access_cycle_iterator<iterator_type_t<Range>>;
+    using const_iterator = random_access_cycle_iterator<const_iterator_type_t<Range>>;
+    using size_type = size_type_t<Range>;
 
-    using size_type = size_t;
+    /**
+     * Cycling an empty range results an empty range.
+     */
+    constexpr const_iterator begin() const
+    { return make_iterator<const_iterator>(range.get(), empty() ? const_iterator::unreachable : 0); }
 
+    constexpr const_iterator end() const
+    { return make_iterator<const_iterator>(range.get(), const_iterator::unreachable); }
 
-    const_iterator begin() const
-    { return const_iterator{t}; }
+    constexpr iterator begin()
+    { return make_iterator<iterator>(range.get(), empty() ? iterator::unreachable : 0); }
 
-    const_iterator end() const
-    { return const_iterator{t}; }
+    constexpr iterator end()
+    { return make_iterator<iterator>(range.get(), iterator::unreachable); }
 
-    T t; // as keeper?
+    constexpr end_marker_t sentinel() const
+    { return {}; }
+
+    constexpr bool empty() const
+    { return ezy::size(range.get()) == 0; }
+
+    constexpr decltype(auto) operator[](size_type index) const
+    { return begin()[static_cast<std::ptrdiff_t>(index)]; }
+
+    Keeper range;
+
+    private:
+      template <typename Iterator, typename RangeType>
+      static constexpr Iterator make_iterator(RangeType& range, typename Iterator::difference_type index)
+      {
+        const auto range_size = static_cast<size_t>(ezy::size(range));
+        return Iterator(std::begin(range), fast_modulo(range_size == 0 ? 1 : range_size), index);
+      }
   };
 
-  template <typename Iter, typename Sentinel = Iter>
-  struct subrange_view
+  /**
+   * repeat_iterator: the same element at every index. Infinite repetitions end at an unreachable index.
+   */
+  template <typename T>
+  struct repeat_iterator : compares_to_end_marker<repeat_iterator<T>>
   {
-    using size_type = size_t; // TODO not general
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::remove_cv_t<T>;
+    using pointer = const T*;
+    using reference = const T&;
+    using iterator_category = std::random_access_iterator_tag;
 
-    Iter first;
-    Sentinel last;
+    constexpr reference operator*() const
+    { return *t; }
 
-    Iter begin()
+    constexpr reference operator[](difference_type) const
+    { return *t; }
+
+    constexpr repeat_iterator& operator++()
     {
-      return first;
+      ++index;
+      return *this;
     }
 
-    Sentinel end()
+    constexpr repeat_iterator operator++(int)
     {
-      return last;
+      auto result = *this;
+      ++index;
+      return result;
     }
 
-    Iter begin() const
+    constexpr repeat_iterator& operator--()
     {
-      return first;
+      --index;
+      return *this;
     }
 
-    Sentinel end() const
+    constexpr repeat_iterator operator--(int)
     {
-      return last;
+      auto result = *this;
+      --index;
+      return result;
     }
-  };
 
-  template <typename Range>
-  struct chunk_iterator
-  {
-    using _iter_traits = std::iterator_traits<iterator_type_t<Range>>;
-    using _nested_iterator = take_iterator<Range>;
-    using difference_type = typename _iter_traits::difference_type;
-    using value_type = typename _iter_traits::value_type;
-    using reference = subrange_view<_nested_iterator>; // typename _iter_traits::reference;
-    using pointer = arrow_proxy<reference>;
-    using iterator_category = std::forward_iterator_tag; // TODO
-    using size_type = size_type_t<Range>;
+    constexpr repeat_iterator& operator+=(difference_type n)
+    {
+      index += n;
+      return *this;
+    }
 
-    constexpr explicit chunk_iterator(Range& range, size_type size)
-      : tracker(range)
-      , size(size)
-    {}
+    constexpr repeat_iterator& operator-=(difference_type n)
+    {
+      index -= n;
+      return *this;
+    }
 
-    constexpr explicit chunk_iterator(Range& range, end_marker_t)
-      : tracker(range, end_marker_t{})
-    {}
+    friend constexpr repeat_iterator operator+(repeat_iterator it, difference_type n)
+    { return it += n; }
 
-    // same as step_by_iterator::op++
-    constexpr chunk_iterator& operator++()
-    {
+    friend constexpr repeat_iterator operator+(difference_type n, repeat_iterator it)
+    { return it += n; }
+
+    friend constexpr repeat_iterator operator-(repeat_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index - rhs.index; }
+
+    friend constexpr bool operator==(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index == rhs.index; }
+
+    friend constexpr bool operator!=(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index != rhs.index; }
+
+    friend constexpr bool operator<(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index < rhs.index; }
+
+    friend constexpr bool operator>(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index > rhs.index; }
+
+    friend constexpr bool operator<=(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index <= rhs.index; }
+
+    friend constexpr bool operator>=(const repeat_iterator& lhs, const repeat_iterator& rhs)
+    { return lhs.index >= rhs.index; }
+
+    constexpr bool is_end() const
+    { return index == unreachable; }
+
+    static constexpr difference_type unreachable = std::numeric_limits<difference_type>::max();
+
+    const T* t;
+    difference_type index;
+  };
+
+  template <typename T>
+  struct repeat_view
+  {
+    using iterator = repeat_iterator<std::remove_reference_t<T>>;
+    using const_iterator = iterator;
+
+    using size_type = size_t;
+
+    constexpr const_iterator begin() const
+    { return const_iterator{{}, &t, 0}; }
+
+    constexpr const_iterator end() const
+    { return const_iterator{{}, &t, const_iterator::unreachable}; }
+
+    constexpr end_marker_t sentinel() const
+    { return {}; }
+
+    T t; // as keeper?
+  };
+
+  /**
+   * repeat_n_view: `count` copies of the same element. Containers constructible from a count and a value
+   * are collected by their fill constructor.
+   */
+  template <typename T>
+  struct repeat_n_view
+  {
+    using iterator = repeat_iterator<T>;
+    using const_iterator = repeat_iterator<T>;
+    using value_type = T;
+    using size_type = size_t;
+
+    constexpr const_iterator begin() const
+    { return const_iterator{{}, &t, 0}; }
+
+    constexpr const_iterator end() const
+    { return const_iterator{{}, &t, static_cast<std::ptrdiff_t>(count)}; }
+
+    constexpr size_type size() const
+    { return count; }
+
+    constexpr bool empty() const
+    { return count == 0; }
+
+    constexpr const T& operator[](size_type) const
+    { return t; }
+
+    constexpr const T& fill_value() const
+    { return t; }
+
+    T t;
+    size_type count;
+  };
+
+  /**
+   * cache_latest_iterator evaluates the element at its position once, on the first dereference, and keeps it
+   * in its view until it is incremented. As there is a single cached element per view, it is an input iterator,
+   * and only a mutable view can be iterated.
+   */
+  template <typename View, typename Iterator>
+  struct cache_latest_iterator
+  {
+    using _iter_traits = std::iterator_traits<Iterator>;
+    using difference_type = typename _iter_traits::difference_type;
+    using value_type = ezy::remove_cvref_t<typename _iter_traits::reference>;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr cache_latest_iterator(View* view, Iterator base)
+      : view(view)
+      , base(std::move(base))
+    {}
+
+    reference operator*() const
+    { return view->cached.get_or_emplace([this]() -> value_type { return *base; }); }
+
+    pointer operator->() const
+    { return &**this; }
+
+    cache_latest_iterator& operator++()
+    {
+      ++base;
+      view->cached.reset();
+      return *this;
+    }
+
+    void operator++(int)
+    { ++*this; }
+
+    friend constexpr bool operator==(const cache_latest_iterator& lhs, const cache_latest_iterator& rhs)
+    { return lhs.base == rhs.base; }
+
+    friend constexpr bool operator!=(const cache_latest_iterator& lhs, const cache_latest_iterator& rhs)
+    { return lhs.base != rhs.base; }
+
+    private:
+      View* view;
+      Iterator base;
+  };
+
+  template <typename Keeper>
+  struct cache_latest_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using iterator = cache_latest_iterator<cache_latest_view, iterator_type_t<Range>>;
+    using value_type = typename iterator::value_type;
+    using size_type = size_type_t<Range>;
+
+    iterator begin()
+    {
+      cached.reset();
+      return iterator(this, std::begin(range.get()));
+    }
+
+    iterator end()
+    { return iterator(this, std::end(range.get())); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr size_type size() const
+    { return static_cast<size_type>(ezy::size(range.get())); }
+
+    constexpr size_hint_t size_hint() const
+    { return detail::size_hint(range.get()); }
+
+    Keeper range;
+    non_propagating_cache<value_type> cached{};
+  };
+
+  /**
+   * memoized_elements: the elements of a range evaluated so far, and the position in the range to continue
+   * from. The elements are stored in a deque, so references to them stay valid while more are evaluated.
+   */
+  template <typename Range>
+  struct memoized_elements
+  {
+    using source_iterator = const_iterator_type_t<Range>;
+    using value_type = ezy::remove_cvref_t<typename std::iterator_traits<source_iterator>::reference>;
+
+    /**
+     * Evaluates the elements until `index`, returns false if the range ends before.
+     */
+    bool evaluate_until(const Range& range, size_t index)
+    {
+      if (index < values.size())
+        return true;
+      if (exhausted)
+        return false;
+
+      auto& position = cached_position.get_or_emplace([&] {
+          return std::next(std::begin(range), static_cast<std::ptrdiff_t>(values.size()));
+        });
+      const auto last = std::end(range);
+      while (index >= values.size())
+      {
+        if (position == last)
+        {
+          exhausted = true;
+          return false;
+        }
+        values.emplace_back(*position);
+        ++position;
+      }
+      return true;
+    }
+
+    std::deque<value_type> values{};
+    non_propagating_cache<source_iterator> cached_position{};
+    bool exhausted{false};
+  };
+
+  /**
+   * memoize_all_iterator: index into the memoized elements of a view. Elements are evaluated when they are
+   * reached first, and replayed afterwards. The end iterator is an index which is never reached.
+   */
+  template <typename View>
+  struct memoize_all_iterator
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename View::value_type;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    using iterator_category = std::forward_iterator_tag;
+
+    constexpr memoize_all_iterator() = default;
+
+    constexpr memoize_all_iterator(const View* view, size_t index)
+      : view(view)
+      , index(index)
+    {}
+
+    reference operator*() const
+    { return view->element(index); }
+
+    pointer operator->() const
+    { return &view->element(index); }
+
+    constexpr memoize_all_iterator& operator++()
+    {
+      ++index;
+      return *this;
+    }
+
+    constexpr memoize_all_iterator operator++(int)
+    {
+      auto result = *this;
+      ++index;
+      return result;
+    }
+
+    friend bool operator==(const memoize_all_iterator& lhs, const memoize_all_iterator& rhs)
+    { return lhs.at_end() == rhs.at_end() && (lhs.at_end() || lhs.index == rhs.index); }
+
+    friend bool operator!=(const memoize_all_iterator& lhs, const memoize_all_iterator& rhs)
+    { return !(lhs == rhs); }
+
+    private:
+      bool at_end() const
+      { return index == end_index || !view->has_element(index); }
+
+      static constexpr size_t end_index = std::numeric_limits<size_t>::max();
+
+      template <typename>
+      friend struct memoize_all_view;
+
+      const View* view{nullptr};
+      size_t index{0};
+  };
+
+  /**
+   * memoize_all_view evaluates the elements of the range once, when they are first reached, and replays them
+   * in later passes. Copies of the view keep the elements evaluated so far.
+   */
+  template <typename Keeper>
+  struct memoize_all_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using value_type = typename memoized_elements<Range>::value_type;
+    using const_iterator = memoize_all_iterator<memoize_all_view>;
+    using iterator = const_iterator;
+    using size_type = size_type_t<Range>;
+
+    explicit memoize_all_view(Keeper&& keeper)
+      : range(std::move(keeper))
+    {}
+
+    const_iterator begin() const
+    { return const_iterator(this, 0); }
+
+    const_iterator end() const
+    { return const_iterator(this, const_iterator::end_index); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr size_type size() const
+    { return static_cast<size_type>(ezy::size(range.get())); }
+
+    constexpr size_hint_t size_hint() const
+    { return detail::size_hint(range.get()); }
+
+    bool has_element(size_t index) const
+    { return memoized.evaluate_until(range.get(), index); }
+
+    const value_type& element(size_t index) const
+    {
+      memoized.evaluate_until(range.get(), index);
+      return memoized.values[index];
+    }
+
+    template <typename Fn>
+    bool for_each_until(Fn&& fn) const
+    {
+      for (size_t index = 0; has_element(index); ++index)
+      {
+        if (!fn(std::as_const(memoized.values[index])))
+          return false;
+      }
+      return true;
+    }
+
+    private:
+      Keeper range;
+      mutable memoized_elements<Range> memoized{};
+  };
+
+  template <typename Iter, typename Sentinel = Iter>
+  struct subrange_view
+  {
+    using size_type = size_t; // TODO not general
+
+    Iter first;
+    Sentinel last;
+
+    Iter begin()
+    {
+      return first;
+    }
+
+    Sentinel end()
+    {
+      return last;
+    }
+
+    Iter begin() const
+    {
+      return first;
+    }
+
+    Sentinel end() const
+    {
+      return last;
+    }
+
+    template <typename I = Iter, typename = std::enable_if_t<std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<I>::iterator_category> && std::is_same_v<I, Sentinel>>>
+    constexpr size_type size() const
+    {
+      return static_cast<size_type>(last - first);
+    }
+
+    constexpr bool empty() const
+    {
+      return first == last;
+    }
+
+    /**
+     * Copies the elements into an owning container, eg. `token.to<std::string>()`.
+     */
+    template <typename Container>
+    Container to() const
+    {
+      return Container(first, last);
+    }
+  };
+
+  static constexpr size_t dynamic_extent = std::numeric_limits<size_t>::max();
+
+  /**
+   * Length of a span_view or a chunk: a compile time constant, or stored if dynamic.
+   */
+  template <size_t Extent>
+  struct extent_storage
+  {
+    constexpr explicit extent_storage(size_t)
+    {}
+
+    static constexpr size_t get() noexcept
+    { return Extent; }
+  };
+
+  template <>
+  struct extent_storage<dynamic_extent>
+  {
+    constexpr explicit extent_storage(size_t length)
+      : length(length)
+    {}
+
+    constexpr size_t get() const noexcept
+    { return length; }
+
+    size_t length;
+  };
+
+  /**
+   * span_view: a contiguous part of a range, a pointer and a length. With a static extent the length is a
+   * compile time constant, so loops over it have a constant trip count.
+   */
+  template <typename T, size_t Extent = dynamic_extent>
+  struct span_view : private extent_storage<Extent>
+  {
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using iterator = T*;
+    using const_iterator = T*;
+
+    static constexpr size_t extent = Extent;
+
+    constexpr span_view(T* first, size_type length)
+      : extent_storage<Extent>(length)
+      , first(first)
+    {}
+
+    constexpr T* begin() const noexcept
+    { return first; }
+
+    constexpr T* end() const noexcept
+    { return first + size(); }
+
+    constexpr T* data() const noexcept
+    { return first; }
+
+    constexpr size_type size() const noexcept
+    { return extent_storage<Extent>::get(); }
+
+    constexpr bool empty() const noexcept
+    { return size() == 0; }
+
+    constexpr reference operator[](size_type index) const
+    { return first[index]; }
+
+    private:
+      T* first;
+  };
+
+  template <typename Range>
+  struct chunk_iterator : compares_to_end_marker<chunk_iterator<Range>>
+  {
+    using _iter_traits = std::iterator_traits<iterator_type_t<Range>>;
+    using _nested_iterator = take_iterator<Range>;
+    using difference_type = typename _iter_traits::difference_type;
+    using value_type = typename _iter_traits::value_type;
+    using reference = subrange_view<_nested_iterator>; // typename _iter_traits::reference;
+    using pointer = arrow_proxy<reference>;
+    using iterator_category = std::forward_iterator_tag; // TODO
+    using size_type = size_type_t<Range>;
+
+    constexpr explicit chunk_iterator(Range& range, size_type size)
+      : tracker(range)
+      , size(size)
+    {}
+
+    constexpr explicit chunk_iterator(Range& range, end_marker_t)
+      : tracker(range, end_marker_t{})
+    {}
+
+    // same as step_by_iterator::op++
+    constexpr chunk_iterator& operator++()
+    {
       size_type step = 0;
       while (step++ < size && tracker.template has_next<0>())
       {
-        tracker.template next<0>();
+        tracker.template next<0>();
+      }
+      return *this;
+    }
+
+    reference operator*()
+    {
+      const auto tracked = tracker.template get<0>();
+      return reference{
+        _nested_iterator(tracked.first, size),
+        _nested_iterator(tracked.second, 0)
+      };
+    }
+
+    pointer operator->()
+    {
+      return pointer{operator*()};
+    }
+
+    constexpr bool operator!=(const chunk_iterator& rhs) const
+    {
+      return tracker.template get<0>().first != rhs.tracker.template get<0>().first;
+    }
+
+    constexpr bool operator==(const chunk_iterator& rhs) const
+    {
+      return !(*this != rhs);
+    }
+
+    constexpr bool is_end() const
+    {
+      return !tracker.template has_next<0>();
+    }
+
+    range_tracker<Range> tracker;
+    size_type size{1};
+  };
+
+  template <typename Keeper>
+  struct chunk_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = chunk_iterator<const Range>;
+    using iterator = chunk_iterator<Range>;
+    using size_type = size_type_t<Range>;
+
+    constexpr const_iterator begin() const
+    {
+      return const_iterator(keeper.get(), chunk_size);
+    }
+
+    constexpr const_iterator end() const
+    {
+      return const_iterator(keeper.get(), end_marker_t{});
+    }
+
+    constexpr iterator begin()
+    {
+      return iterator(keeper.get(), chunk_size);
+    }
+
+    constexpr iterator end()
+    {
+      return iterator(keeper.get(), end_marker_t{});
+    }
+
+    constexpr end_marker_t sentinel() const
+    {
+      return {};
+    }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return (range_size + chunk_size - 1) / chunk_size;
+    }
+
+    constexpr size_hint_t size_hint() const
+    {
+      return ceil_div_hint(detail::size_hint(keeper.get()), chunk_size);
+    }
+
+    Keeper keeper;
+    const size_type chunk_size;
+  };
+
+  /**
+   * Chunks of contiguous ranges are span_views: their size is known and their elements are accessed by
+   * pointer. With a static extent every chunk is full, the remaining elements are not visited.
+   */
+  template <typename T, size_t Extent>
+  struct contiguous_chunk_iterator : compares_to_end_marker<contiguous_chunk_iterator<T, Extent>>
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = span_view<T, Extent>;
+    using reference = span_view<T, Extent>;
+    using pointer = arrow_proxy<reference>;
+    using iterator_category = std::random_access_iterator_tag;
+    using size_type = size_t;
+
+    constexpr contiguous_chunk_iterator() = default;
+
+    constexpr contiguous_chunk_iterator(T* base, size_type length, size_type index, size_type chunk_size)
+      : base(base)
+      , length(length)
+      , index(index)
+      , chunk_size(chunk_size)
+    {}
+
+    constexpr reference operator*() const
+    {
+      const size_type offset = index * chunk_size.get();
+      return reference(base + offset, std::min(chunk_size.get(), length - offset));
+    }
+
+    constexpr pointer operator->() const
+    { return pointer{operator*()}; }
+
+    constexpr reference operator[](difference_type n) const
+    { return *(*this + n); }
+
+    constexpr contiguous_chunk_iterator& operator++()
+    {
+      ++index;
+      return *this;
+    }
+
+    constexpr contiguous_chunk_iterator operator++(int)
+    {
+      auto result = *this;
+      ++index;
+      return result;
+    }
+
+    constexpr contiguous_chunk_iterator& operator--()
+    {
+      --index;
+      return *this;
+    }
+
+    constexpr contiguous_chunk_iterator operator--(int)
+    {
+      auto result = *this;
+      --index;
+      return result;
+    }
+
+    constexpr contiguous_chunk_iterator& operator+=(difference_type n)
+    {
+      index = static_cast<size_type>(static_cast<difference_type>(index) + n);
+      return *this;
+    }
+
+    constexpr contiguous_chunk_iterator& operator-=(difference_type n)
+    { return *this += -n; }
+
+    friend constexpr contiguous_chunk_iterator operator+(contiguous_chunk_iterator it, difference_type n)
+    { return it += n; }
+
+    friend constexpr contiguous_chunk_iterator operator+(difference_type n, contiguous_chunk_iterator it)
+    { return it += n; }
+
+    friend constexpr contiguous_chunk_iterator operator-(contiguous_chunk_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return static_cast<difference_type>(lhs.index) - static_cast<difference_type>(rhs.index); }
+
+    friend constexpr bool operator==(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index == rhs.index; }
+
+    friend constexpr bool operator!=(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index != rhs.index; }
+
+    friend constexpr bool operator<(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index < rhs.index; }
+
+    friend constexpr bool operator>(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index > rhs.index; }
+
+    friend constexpr bool operator<=(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index <= rhs.index; }
+
+    friend constexpr bool operator>=(const contiguous_chunk_iterator& lhs, const contiguous_chunk_iterator& rhs)
+    { return lhs.index >= rhs.index; }
+
+    constexpr bool is_end() const
+    { return index * chunk_size.get() >= length; }
+
+    private:
+      T* base{nullptr};
+      size_type length{0};
+      size_type index{0};
+      extent_storage<Extent> chunk_size{1};
+  };
+
+  template <typename Keeper, size_t Extent = dynamic_extent>
+  struct contiguous_chunk_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using _element_type = std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>;
+    using _const_element_type = std::remove_pointer_t<decltype(std::data(std::declval<const Range&>()))>;
+    using const_iterator = contiguous_chunk_iterator<_const_element_type, Extent>;
+    using iterator = contiguous_chunk_iterator<_element_type, Extent>;
+    using size_type = size_t;
+
+    constexpr contiguous_chunk_range_view(Keeper&& keeper, size_type chunk_size)
+      : keeper(std::move(keeper))
+      , chunk_size(chunk_size)
+    {}
+
+    constexpr const_iterator begin() const
+    { return const_iterator(std::data(keeper.get()), visited_length(), 0, chunk_size.get()); }
+
+    constexpr const_iterator end() const
+    { return const_iterator(std::data(keeper.get()), visited_length(), size(), chunk_size.get()); }
+
+    constexpr iterator begin()
+    { return iterator(std::data(keeper.get()), visited_length(), 0, chunk_size.get()); }
+
+    constexpr iterator end()
+    { return iterator(std::data(keeper.get()), visited_length(), size(), chunk_size.get()); }
+
+    constexpr end_marker_t sentinel() const
+    { return {}; }
+
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      if constexpr (Extent == dynamic_extent)
+        return (range_size + chunk_size.get() - 1) / chunk_size.get();
+      else
+        return range_size / Extent;
+    }
+
+    /**
+     * The elements after the last full chunk, which are not visited if the extent is static.
+     */
+    constexpr span_view<_const_element_type> remainder() const
+    {
+      const size_type visited = size() * chunk_size.get();
+      const size_type range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return {std::data(keeper.get()) + std::min(visited, range_size), range_size - std::min(visited, range_size)};
+    }
+
+    Keeper keeper;
+    extent_storage<Extent> chunk_size;
+
+    private:
+      constexpr size_type visited_length() const
+      {
+        const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+        return Extent == dynamic_extent ? range_size : range_size / Extent * Extent;
+      }
+  };
+
+  /**
+   * Windows of contiguous ranges are span_views of `n` consecutive elements, starting at every element.
+   */
+  template <typename T, size_t Extent>
+  struct contiguous_window_iterator
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = span_view<T, Extent>;
+    using reference = span_view<T, Extent>;
+    using pointer = arrow_proxy<reference>;
+    using iterator_category = std::random_access_iterator_tag;
+    using size_type = size_t;
+
+    constexpr contiguous_window_iterator() = default;
+
+    constexpr contiguous_window_iterator(T* first, size_type window_size)
+      : first(first)
+      , window_size(window_size)
+    {}
+
+    constexpr reference operator*() const
+    { return reference(first, window_size.get()); }
+
+    constexpr pointer operator->() const
+    { return pointer{operator*()}; }
+
+    constexpr reference operator[](difference_type n) const
+    { return reference(first + n, window_size.get()); }
+
+    constexpr contiguous_window_iterator& operator++()
+    {
+      ++first;
+      return *this;
+    }
+
+    constexpr contiguous_window_iterator operator++(int)
+    {
+      auto result = *this;
+      ++first;
+      return result;
+    }
+
+    constexpr contiguous_window_iterator& operator--()
+    {
+      --first;
+      return *this;
+    }
+
+    constexpr contiguous_window_iterator operator--(int)
+    {
+      auto result = *this;
+      --first;
+      return result;
+    }
+
+    constexpr contiguous_window_iterator& operator+=(difference_type n)
+    {
+      first += n;
+      return *this;
+    }
+
+    constexpr contiguous_window_iterator& operator-=(difference_type n)
+    {
+      first -= n;
+      return *this;
+    }
+
+    friend constexpr contiguous_window_iterator operator+(contiguous_window_iterator it, difference_type n)
+    { return it += n; }
+
+    friend constexpr contiguous_window_iterator operator+(difference_type n, contiguous_window_iterator it)
+    { return it += n; }
+
+    friend constexpr contiguous_window_iterator operator-(contiguous_window_iterator it, difference_type n)
+    { return it -= n; }
+
+    friend constexpr difference_type operator-(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first - rhs.first; }
+
+    friend constexpr bool operator==(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first == rhs.first; }
+
+    friend constexpr bool operator!=(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first != rhs.first; }
+
+    friend constexpr bool operator<(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first < rhs.first; }
+
+    friend constexpr bool operator>(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first > rhs.first; }
+
+    friend constexpr bool operator<=(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first <= rhs.first; }
+
+    friend constexpr bool operator>=(const contiguous_window_iterator& lhs, const contiguous_window_iterator& rhs)
+    { return lhs.first >= rhs.first; }
+
+    private:
+      T* first{nullptr};
+      extent_storage<Extent> window_size{1};
+  };
+
+  template <typename Keeper, size_t Extent = dynamic_extent>
+  struct contiguous_window_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using _element_type = std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>;
+    using _const_element_type = std::remove_pointer_t<decltype(std::data(std::declval<const Range&>()))>;
+    using const_iterator = contiguous_window_iterator<_const_element_type, Extent>;
+    using iterator = contiguous_window_iterator<_element_type, Extent>;
+    using size_type = size_t;
+
+    constexpr contiguous_window_range_view(Keeper&& keeper, size_type window_size)
+      : keeper(std::move(keeper))
+      , window_size(window_size)
+    {}
+
+    constexpr const_iterator begin() const
+    { return const_iterator(std::data(keeper.get()), window_size.get()); }
+
+    constexpr const_iterator end() const
+    { return begin() + static_cast<std::ptrdiff_t>(size()); }
+
+    constexpr iterator begin()
+    { return iterator(std::data(keeper.get()), window_size.get()); }
+
+    constexpr iterator end()
+    { return begin() + static_cast<std::ptrdiff_t>(size()); }
+
+    constexpr size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return window_size.get() == 0 || range_size < window_size.get() ? 0 : range_size - window_size.get() + 1;
+    }
+
+    Keeper keeper;
+    extent_storage<Extent> window_size;
+  };
+
+  /**
+   * Windows of forward ranges are subrange_views: both ends of the window step forward together.
+   */
+  template <typename Range>
+  struct window_iterator
+  {
+    using _orig_iterator = iterator_type_t<Range>;
+    using difference_type = typename std::iterator_traits<_orig_iterator>::difference_type;
+    using value_type = subrange_view<_orig_iterator>;
+    using reference = subrange_view<_orig_iterator>;
+    using pointer = arrow_proxy<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using size_type = size_type_t<Range>;
+
+    window_iterator() = default;
+
+    window_iterator(Range& range, size_type window_size)
+      : first(std::begin(range))
+      , last(std::begin(range))
+      , range_end(std::end(range))
+    {
+      for (size_type i = 0; i < window_size; ++i)
+      {
+        if (last == range_end)
+        {
+          first = range_end;
+          return;
+        }
+        ++last;
+      }
+    }
+
+    window_iterator(Range& range, end_marker_t)
+      : first(std::end(range))
+      , last(std::end(range))
+      , range_end(std::end(range))
+    {}
+
+    reference operator*() const
+    { return reference{first, last}; }
+
+    pointer operator->() const
+    { return pointer{operator*()}; }
+
+    /**
+     * After the last window the iterator points to the end of the range.
+     */
+    window_iterator& operator++()
+    {
+      if (last == range_end)
+      {
+        first = range_end;
+      }
+      else
+      {
+        ++first;
+        ++last;
+      }
+      return *this;
+    }
+
+    window_iterator operator++(int)
+    {
+      auto result = *this;
+      ++(*this);
+      return result;
+    }
+
+    friend bool operator==(const window_iterator& lhs, const window_iterator& rhs)
+    { return lhs.first == rhs.first; }
+
+    friend bool operator!=(const window_iterator& lhs, const window_iterator& rhs)
+    { return lhs.first != rhs.first; }
+
+    private:
+      _orig_iterator first;
+      _orig_iterator last;
+      _orig_iterator range_end;
+  };
+
+  template <typename Keeper>
+  struct window_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = window_iterator<const Range>;
+    using iterator = window_iterator<Range>;
+    using size_type = size_type_t<Range>;
+
+    /**
+     * There are no windows of size 0.
+     */
+    const_iterator begin() const
+    { return window_size == 0 ? end() : const_iterator(keeper.get(), window_size); }
+
+    const_iterator end() const
+    { return const_iterator(keeper.get(), end_marker_t{}); }
+
+    iterator begin()
+    { return window_size == 0 ? end() : iterator(keeper.get(), window_size); }
+
+    iterator end()
+    { return iterator(keeper.get(), end_marker_t{}); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    size_type size() const
+    {
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return window_size == 0 || range_size < window_size ? 0 : range_size - window_size + 1;
+    }
+
+    size_hint_t size_hint() const
+    {
+      if (window_size == 0)
+        return size_hint_t::exact(0);
+      return drop_hint(detail::size_hint(keeper.get()), window_size - 1);
+    }
+
+    Keeper keeper;
+    size_type window_size;
+  };
+
+  /**
+   * A window of an input range: the last `size()` elements, stored in a ring buffer starting at `start`.
+   */
+  template <typename T>
+  struct ring_window
+  {
+    struct iterator
+    {
+      using difference_type = std::ptrdiff_t;
+      using value_type = T;
+      using reference = const T&;
+      using pointer = const T*;
+      using iterator_category = std::forward_iterator_tag;
+
+      reference operator*() const
+      { return window->operator[](offset); }
+
+      pointer operator->() const
+      { return &operator*(); }
+
+      iterator& operator++()
+      {
+        ++offset;
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        auto result = *this;
+        ++offset;
+        return result;
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      { return lhs.offset == rhs.offset; }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      { return lhs.offset != rhs.offset; }
+
+      const ring_window* window;
+      size_t offset;
+    };
+
+    using value_type = T;
+    using size_type = size_t;
+    using const_iterator = iterator;
+
+    iterator begin() const
+    { return iterator{this, 0}; }
+
+    iterator end() const
+    { return iterator{this, length}; }
+
+    size_type size() const
+    { return length; }
+
+    const T& operator[](size_type index) const
+    {
+      const size_type position = start + index;
+      return buffer[position < length ? position : position - length];
+    }
+
+    const T* buffer;
+    size_type length;
+    size_type start;
+  };
+
+  /**
+   * Windows of input ranges: the elements are read once into a ring buffer owned by the view, which is
+   * allocated only once. As the source, the view is single-pass, and as it writes the buffer, it can be iterated
+   * only as mutable.
+   */
+  template <typename View>
+  struct buffered_window_iterator
+  {
+    using _orig_iterator = typename View::_orig_iterator;
+    using _element_type = typename View::_element_type;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ring_window<_element_type>;
+    using reference = ring_window<_element_type>;
+    using pointer = arrow_proxy<reference>;
+    using iterator_category = std::input_iterator_tag;
+
+    buffered_window_iterator() = default;
+
+    explicit buffered_window_iterator(View& view)
+      : view(&view)
+      , current(std::begin(view.keeper.get()))
+    {
+      auto& buffer = view.buffer;
+      buffer.clear();
+      buffer.reserve(view.window_size);
+      for (; buffer.size() < view.window_size && current != std::end(view.keeper.get()); ++current)
+        buffer.push_back(*current);
+
+      done = buffer.size() < view.window_size;
+    }
+
+    reference operator*() const
+    { return reference{view->buffer.data(), view->window_size, start}; }
+
+    pointer operator->() const
+    { return pointer{operator*()}; }
+
+    buffered_window_iterator& operator++()
+    {
+      if (current == std::end(view->keeper.get()))
+      {
+        done = true;
+        return *this;
+      }
+
+      view->buffer[start] = *current;
+      ++current;
+      start = start + 1 == view->window_size ? 0 : start + 1;
+      return *this;
+    }
+
+    void operator++(int)
+    { ++(*this); }
+
+    friend bool operator==(const buffered_window_iterator& lhs, const buffered_window_iterator& rhs)
+    { return lhs.done == rhs.done; }
+
+    friend bool operator!=(const buffered_window_iterator& lhs, const buffered_window_iterator& rhs)
+    { return lhs.done != rhs.done; }
+
+    private:
+      View* view{nullptr};
+      _orig_iterator current{};
+      size_t start{0};
+      bool done{true};
+  };
+
+  template <typename Keeper>
+  struct buffered_window_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using _orig_iterator = iterator_type_t<Range>;
+    using _element_type = std::remove_cv_t<typename std::iterator_traits<_orig_iterator>::value_type>;
+    using iterator = buffered_window_iterator<buffered_window_range_view>;
+    using size_type = size_t;
+
+    buffered_window_range_view(Keeper&& keeper, size_type window_size)
+      : keeper(std::move(keeper))
+      , window_size(window_size)
+    {}
+
+    /**
+     * There are no windows of size 0.
+     */
+    iterator begin()
+    { return window_size == 0 ? end() : iterator(*this); }
+
+    iterator end()
+    { return iterator(); }
+
+    Keeper keeper;
+    size_type window_size;
+    std::vector<_element_type> buffer;
+  };
+
+  /**
+   * Aggregation state of a rolling window, updated in amortized O(1) when an element enters (`push`) or
+   * leaves (`pop`) the window. Elements leave in the order they entered, `index` is their position.
+   */
+  template <typename T, typename Op, typename Inverse>
+  struct rolling_invertible_state
+  {
+    rolling_invertible_state(const Op& op, const Inverse& inverse)
+      : op(op)
+      , inverse(inverse)
+    {}
+
+    void push(size_t, const T& t)
+    {
+      value = empty ? t : op.get()(value, t);
+      empty = false;
+    }
+
+    void pop(size_t, const T& t)
+    {
+      value = inverse.get()(value, t);
+    }
+
+    const T& get() const
+    { return value; }
+
+    copyable_box<Op> op;
+    copyable_box<Inverse> inverse;
+    T value{};
+    bool empty{true};
+  };
+
+  /**
+   * Minimum or maximum: a deque of the elements which can still become the extremum, ordered by `Compare`.
+   */
+  template <typename T, typename Compare>
+  struct rolling_monotonic_state
+  {
+    void push(size_t index, const T& t)
+    {
+      while (!candidates.empty() && !Compare{}(candidates.back().second, t))
+        candidates.pop_back();
+      candidates.emplace_back(index, t);
+    }
+
+    void pop(size_t index, const T&)
+    {
+      if (candidates.front().first == index)
+        candidates.pop_front();
+    }
+
+    const T& get() const
+    { return candidates.front().second; }
+
+    std::deque<std::pair<size_t, T>> candidates;
+  };
+
+  /**
+   * Any associative operation: entering elements are pushed to `back`, keeping their running aggregate.
+   * When the oldest element leaves and `front` is empty, `back` is moved over to `front` storing the
+   * aggregates of the newer elements, so each element is moved once.
+   */
+  template <typename T, typename Op>
+  struct rolling_two_stacks_state
+  {
+    explicit rolling_two_stacks_state(const Op& op)
+      : op(op)
+    {}
+
+    void push(size_t, const T& t)
+    {
+      back_aggregate = back.empty() ? t : op.get()(back_aggregate, t);
+      back.push_back(t);
+    }
+
+    void pop(size_t, const T&)
+    {
+      if (front.empty())
+      {
+        for (auto it = back.rbegin(); it != back.rend(); ++it)
+          front.push_back(front.empty() ? *it : op.get()(*it, front.back()));
+        back.clear();
+      }
+      front.pop_back();
+      current.reset();
+    }
+
+    const T& get() const
+    {
+      if (!current)
+      {
+        if (front.empty())
+          current = back_aggregate;
+        else if (back.empty())
+          current = front.back();
+        else
+          current = op.get()(front.back(), back_aggregate);
+      }
+      return *current;
+    }
+
+    copyable_box<Op> op;
+    std::vector<T> front; // aggregates, the oldest element on the top
+    std::vector<T> back;
+    T back_aggregate{};
+    mutable std::optional<T> current;
+  };
+
+  /**
+   * Invertible operations, whose aggregate can be updated by removing the leaving element.
+   */
+  template <typename Op, typename Inverse>
+  struct invertible_op
+  {
+    template <typename T>
+    constexpr decltype(auto) operator()(const T& lhs, const T& rhs) const
+    { return op(lhs, rhs); }
+
+    Op op;
+    Inverse inverse;
+  };
+
+  template <typename T, typename Op>
+  struct rolling_state
+  {
+    using type = rolling_two_stacks_state<T, Op>;
+
+    static type make(const Op& op)
+    { return type(op); }
+  };
+
+  template <typename T, typename Op, typename Inverse>
+  struct rolling_state<T, invertible_op<Op, Inverse>>
+  {
+    using type = rolling_invertible_state<T, Op, Inverse>;
+
+    static type make(const invertible_op<Op, Inverse>& op)
+    { return type(op.op, op.inverse); }
+  };
+
+  template <typename T, typename U>
+  struct rolling_state<T, std::plus<U>>
+  {
+    using type = rolling_invertible_state<T, std::plus<U>, std::minus<U>>;
+
+    static type make(const std::plus<U>& op)
+    { return type(op, std::minus<U>{}); }
+  };
+
+  template <typename T>
+  struct rolling_state<T, ezy::min_fn>
+  {
+    using type = rolling_monotonic_state<T, std::less<>>;
+
+    static type make(const ezy::min_fn&)
+    { return type{}; }
+  };
+
+  template <typename T>
+  struct rolling_state<T, ezy::max_fn>
+  {
+    using type = rolling_monotonic_state<T, std::greater<>>;
+
+    static type make(const ezy::max_fn&)
+    { return type{}; }
+  };
+
+  template <typename Range, typename Op>
+  struct rolling_iterator
+  {
+    using _orig_iterator = iterator_type_t<Range>;
+    using _state_traits = rolling_state<std::remove_cv_t<value_type_t<Range>>, Op>;
+    using difference_type = typename std::iterator_traits<_orig_iterator>::difference_type;
+    using value_type = std::remove_cv_t<value_type_t<Range>>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using iterator_category = std::input_iterator_tag;
+    using size_type = size_type_t<Range>;
+
+    rolling_iterator(Range& range, size_type window_size, const Op& op)
+      : first(std::begin(range))
+      , last(std::begin(range))
+      , range_end(std::end(range))
+      , window_size(window_size)
+      , state(_state_traits::make(op))
+    {
+      for (size_type i = 0; i < window_size; ++i, ++last)
+      {
+        if (last == range_end)
+        {
+          first = range_end;
+          return;
+        }
+        state.push(i, *last);
       }
-      return *this;
     }
 
-    reference operator*()
-    {
-      const auto tracked = tracker.template get<0>();
-      return reference{
-        _nested_iterator(tracked.first, size),
-        _nested_iterator(tracked.second, 0)
-      };
-    }
+    rolling_iterator(Range& range, const Op& op, end_marker_t)
+      : first(std::end(range))
+      , last(std::end(range))
+      , range_end(std::end(range))
+      , state(_state_traits::make(op))
+    {}
 
-    pointer operator->()
-    {
-      return pointer{operator*()};
-    }
+    reference operator*() const
+    { return state.get(); }
 
-    constexpr bool operator!=(const chunk_iterator& rhs) const
-    {
-      return tracker.template get<0>().first != rhs.tracker.template get<0>().first;
-    }
+    pointer operator->() const
+    { return &state.get(); }
 
-    constexpr bool operator==(const chunk_iterator& rhs) const
+    rolling_iterator& operator++()
     {
-      return !(*this != rhs);
+      if (last == range_end)
+      {
+        first = range_end;
+        return *this;
+      }
+
+      state.pop(index, *first);
+      state.push(index + window_size, *last);
+      ++first;
+      ++last;
+      ++index;
+      return *this;
     }
 
-    range_tracker<Range> tracker;
-    size_type size{1};
+    void operator++(int)
+    { ++(*this); }
+
+    friend bool operator==(const rolling_iterator& lhs, const rolling_iterator& rhs)
+    { return lhs.first == rhs.first; }
+
+    friend bool operator!=(const rolling_iterator& lhs, const rolling_iterator& rhs)
+    { return lhs.first != rhs.first; }
+
+    private:
+      _orig_iterator first;
+      _orig_iterator last;
+      _orig_iterator range_end;
+      size_type window_size{0};
+      size_t index{0};
+      typename _state_traits::type state;
   };
 
-  template <typename Keeper>
-  struct chunk_range_view
+  template <typename Keeper, typename Op>
+  struct rolling_range_view
   {
     using Range = ezy::experimental::keeper_value_type_t<Keeper>;
-    using const_iterator = chunk_iterator<const Range>;
-    using iterator = chunk_iterator<Range>;
+    using const_iterator = rolling_iterator<const Range, Op>;
+    using iterator = const_iterator;
     using size_type = size_type_t<Range>;
 
-    constexpr const_iterator begin() const
-    {
-      return const_iterator(keeper.get(), size);
-    }
+    static_assert(does_range_iterator_implement_v<Range, std::forward_iterator_tag>,
+        "rolling needs a forward range, as leaving elements are read again");
 
-    constexpr const_iterator end() const
-    {
-      return const_iterator(keeper.get(), end_marker_t{});
-    }
+    /**
+     * There are no windows of size 0.
+     */
+    const_iterator begin() const
+    { return window_size == 0 ? end() : const_iterator(keeper.get(), window_size, op); }
 
-    constexpr iterator begin()
+    const_iterator end() const
+    { return const_iterator(keeper.get(), op, end_marker_t{}); }
+
+    template <typename R = Range, typename = std::enable_if_t<is_sized_range_v<R>>>
+    size_type size() const
     {
-      return iterator(keeper.get(), size);
+      const auto range_size = static_cast<size_type>(ezy::size(keeper.get()));
+      return window_size == 0 || range_size < window_size ? 0 : range_size - window_size + 1;
     }
 
-    constexpr iterator end()
+    size_hint_t size_hint() const
     {
-      return iterator(keeper.get(), end_marker_t{});
+      if (window_size == 0)
+        return size_hint_t::exact(0);
+      return drop_hint(detail::size_hint(keeper.get()), window_size - 1);
     }
 
-
     Keeper keeper;
-    const size_type size;
+    size_type window_size;
+    Op op;
+  };
+
+  /**
+   * sentinel_range_view: the same range, but its end() returns the sentinel of the underlying range, if there
+   * is any. So it can be used in range-based for loops, but not with APIs expecting an iterator pair.
+   */
+  template <typename Keeper>
+  struct sentinel_range_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+
+    constexpr auto begin()
+    { return std::begin(range.get()); }
+
+    constexpr auto end()
+    { return end_or_sentinel(range.get()); }
+
+    constexpr auto begin() const
+    { return std::begin(range.get()); }
+
+    constexpr auto end() const
+    { return end_or_sentinel(range.get()); }
+
+    Keeper range;
   };
 
+  template <typename Elem, typename Delimiter>
+  constexpr bool is_delimiter(const Elem& elem, const Delimiter& delimiter)
+  {
+    if constexpr (std::is_same_v<std::remove_cv_t<Delimiter>, char_set>)
+      return delimiter.contains(elem);
+    else
+      return elem == delimiter;
+  }
+
   template <typename It, typename Elem>
   constexpr It find(It first, It last, Elem&& e)
   {
     for (;first != last; ++first)
     {
-      if (*first == e)
+      if (is_delimiter(*first, e))
         return first;
     }
     return last;
@@ -1797,23 +4568,91 @@ namespace detail
   {
     for (;first != last; ++first)
     {
-      if (*first != e)
+      if (!is_delimiter(*first, e))
         return first;
     }
     return last;
   }
 
+  /**
+   * Delimiters in contiguous byte ranges are searched by the kernels of ezy/bits/char_scan.h.
+   */
+  template <typename Range, typename Delimiter, typename = void>
+  struct is_scannable_split : std::false_type {};
+
+  template <typename Range, typename Delimiter>
+  struct is_scannable_split<Range, Delimiter, std::enable_if_t<is_contiguous_range_v<Range>>>
+    : std::bool_constant<
+        is_byte_like_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>>>
+        && (is_byte_like_v<std::remove_cv_t<Delimiter>> || std::is_same_v<std::remove_cv_t<Delimiter>, char_set>)>
+  {};
+
+  template <bool Negate, typename It, typename Delimiter>
+  It scan_delimiter(It first, It last, const Delimiter& delimiter)
+  {
+    if (first == last)
+      return last;
+
+    const char* begin = reinterpret_cast<const char*>(std::addressof(*first));
+    const char* end = begin + (last - first);
+    const char* found = nullptr;
+    if constexpr (std::is_same_v<std::remove_cv_t<Delimiter>, char_set>)
+      found = Negate ? char_scan::find_not(begin, end, delimiter) : char_scan::find(begin, end, delimiter);
+    else
+    {
+      const auto c = static_cast<char>(delimiter);
+      found = Negate ? char_scan::find_not(begin, end, c) : char_scan::find(begin, end, c);
+    }
+    return first + (found - begin);
+  }
+
+  template <typename T>
+  constexpr bool is_character_type_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t>
+    || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+  /**
+   * Parts of a split range do not own their elements: they are string_views of contiguous character ranges,
+   * and subrange_views otherwise.
+   */
+  template <typename Range, typename = void>
+  struct split_part
+  {
+    using type = subrange_view<iterator_type_t<Range>>;
+
+    template <typename Iterator>
+    static type make(Iterator first, Iterator last)
+    { return type{first, last}; }
+  };
+
+  template <typename Range>
+  struct split_part<Range, std::enable_if_t<is_contiguous_range_v<Range>
+    && is_character_type_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>>>>>
+  {
+    using char_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>>;
+    using type = std::basic_string_view<char_type>;
+
+    /**
+     * Parts are never empty, so `first` can be dereferenced.
+     */
+    template <typename Iterator>
+    static type make(Iterator first, Iterator last)
+    { return type(std::addressof(*first), static_cast<size_t>(std::distance(first, last))); }
+  };
+
+  template <typename Range>
+  using split_part_t = typename split_part<Range>::type;
+
   template <typename Range, typename Delimiter>
   struct split_iterator
   {
     using orig_type = iterator_type_t<Range>;
     using _iter_traits = std::iterator_traits<iterator_type_t<Range>>;
 
-    using subrange_type = Range;
+    using subrange_type = split_part_t<Range>;
 
     using difference_type = typename _iter_traits::difference_type;
-    using value_type = Range;
-    using reference = Range;
+    using value_type = subrange_type;
+    using reference = subrange_type;
     using pointer = arrow_proxy<value_type>;
     using iterator_category = std::forward_iterator_tag;
     using size_type = size_type_t<Range>;
@@ -1827,9 +4666,14 @@ namespace detail
       operator++();
     }
 
-    reference operator*()
+    reference operator*() const
+    {
+      return split_part<Range>::make(first, last);
+    }
+
+    pointer operator->() const
     {
-      return reference{first, last};
+      return pointer{operator*()};
     }
 
     split_iterator& operator++()
@@ -1840,13 +4684,20 @@ namespace detail
         return *this;
       }
 
-      first = find_not(last, range_end, delimiter);
+      if constexpr (is_scannable_split<Range, Delimiter>::value)
+        first = scan_delimiter<true>(last, range_end, delimiter);
+      else
+        first = detail::find_not(last, range_end, delimiter);
+
       if (first == range_end)
       {
         return *this;
       }
 
-      last = find(first, range_end, delimiter);
+      if constexpr (is_scannable_split<Range, Delimiter>::value)
+        last = scan_delimiter<false>(first, range_end, delimiter);
+      else
+        last = detail::find(first, range_end, delimiter);
       return *this;
     }
 
@@ -1896,9 +4747,254 @@ namespace detail
       return const_iterator(std::end(range.get()), delimiter.get(), std::end(range.get()));
     }
 
+    /**
+     * Parts are not empty and separated by at least one delimiter.
+     */
+    size_hint_t size_hint() const
+    {
+      const auto hint = detail::size_hint(range.get());
+      return size_hint_t{0, hint.upper ? std::optional<size_t>((*hint.upper + 1) / 2) : std::nullopt};
+    }
+
     RangeKeeper range;
     DelimiterKeeper delimiter;
   };
+
+  /**
+   * Iterates over the lines of a contiguous character buffer, without their '\n' terminators. Unlike split,
+   * empty lines are kept. The last line does not need a terminator.
+   */
+  struct line_iterator
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::string_view;
+    using reference = std::string_view;
+    using pointer = arrow_proxy<value_type>;
+    using iterator_category = std::forward_iterator_tag;
+
+    line_iterator() = default;
+
+    line_iterator(const char* first, const char* last)
+      : first(first)
+      , line_end(char_scan::find(first, last, '\n'))
+      , last(last)
+    {}
+
+    reference operator*() const
+    {
+      return reference(first, static_cast<size_t>(line_end - first));
+    }
+
+    pointer operator->() const
+    {
+      return pointer{operator*()};
+    }
+
+    line_iterator& operator++()
+    {
+      first = line_end == last ? last : line_end + 1;
+      line_end = char_scan::find(first, last, '\n');
+      return *this;
+    }
+
+    line_iterator operator++(int)
+    {
+      auto result = *this;
+      ++(*this);
+      return result;
+    }
+
+    friend bool operator==(const line_iterator& lhs, const line_iterator& rhs)
+    {
+      return lhs.first == rhs.first;
+    }
+
+    friend bool operator!=(const line_iterator& lhs, const line_iterator& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    private:
+      const char* first{nullptr};
+      const char* line_end{nullptr};
+      const char* last{nullptr};
+  };
+
+  template <typename Keeper>
+  struct lines_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = line_iterator;
+    using iterator = line_iterator;
+
+    static_assert(is_contiguous_range_v<const Range>, "lines needs a contiguous range of characters");
+
+    const_iterator begin() const
+    {
+      const char* first = std::data(range.get());
+      return const_iterator(first, first + ezy::size(range.get()));
+    }
+
+    const_iterator end() const
+    {
+      const char* last = std::data(range.get()) + ezy::size(range.get());
+      return const_iterator(last, last);
+    }
+
+    /**
+     * A line takes at least one character, except the last one.
+     */
+    size_hint_t size_hint() const
+    {
+      const auto size = static_cast<size_t>(ezy::size(range.get()));
+      return size_hint_t{size > 0 ? 1u : 0u, size};
+    }
+
+    Keeper range;
+  };
+
+  /**
+   * Iterates over fixed size records of a contiguous character buffer. A trailing partial record is not
+   * visited.
+   */
+  struct record_iterator
+  {
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::string_view;
+    using reference = std::string_view;
+    using pointer = arrow_proxy<value_type>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    record_iterator() = default;
+
+    record_iterator(const char* first, size_t record_size)
+      : first(first)
+      , record_size(record_size)
+    {}
+
+    reference operator*() const
+    {
+      return reference(first, record_size);
+    }
+
+    pointer operator->() const
+    {
+      return pointer{operator*()};
+    }
+
+    reference operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    record_iterator& operator++()
+    {
+      first += record_size;
+      return *this;
+    }
+
+    record_iterator operator++(int)
+    {
+      auto result = *this;
+      ++(*this);
+      return result;
+    }
+
+    record_iterator& operator--()
+    {
+      first -= record_size;
+      return *this;
+    }
+
+    record_iterator operator--(int)
+    {
+      auto result = *this;
+      --(*this);
+      return result;
+    }
+
+    record_iterator& operator+=(difference_type n)
+    {
+      first += n * static_cast<difference_type>(record_size);
+      return *this;
+    }
+
+    record_iterator& operator-=(difference_type n)
+    {
+      return *this += -n;
+    }
+
+    friend record_iterator operator+(record_iterator it, difference_type n)
+    {
+      return it += n;
+    }
+
+    friend record_iterator operator+(difference_type n, record_iterator it)
+    {
+      return it += n;
+    }
+
+    friend record_iterator operator-(record_iterator it, difference_type n)
+    {
+      return it -= n;
+    }
+
+    friend difference_type operator-(const record_iterator& lhs, const record_iterator& rhs)
+    {
+      return (lhs.first - rhs.first) / static_cast<difference_type>(lhs.record_size);
+    }
+
+    friend bool operator==(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first == rhs.first; }
+
+    friend bool operator!=(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first != rhs.first; }
+
+    friend bool operator<(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first < rhs.first; }
+
+    friend bool operator>(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first > rhs.first; }
+
+    friend bool operator<=(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first <= rhs.first; }
+
+    friend bool operator>=(const record_iterator& lhs, const record_iterator& rhs)
+    { return lhs.first >= rhs.first; }
+
+    private:
+      const char* first{nullptr};
+      size_t record_size{1};
+  };
+
+  template <typename Keeper>
+  struct records_view
+  {
+    using Range = ezy::experimental::keeper_value_type_t<Keeper>;
+    using const_iterator = record_iterator;
+    using iterator = record_iterator;
+    using size_type = size_t;
+
+    static_assert(is_contiguous_range_v<const Range>, "records needs a contiguous range of characters");
+
+    const_iterator begin() const
+    {
+      return const_iterator(std::data(range.get()), record_size);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(std::data(range.get()) + size() * record_size, record_size);
+    }
+
+    size_type size() const
+    {
+      return static_cast<size_type>(ezy::size(range.get())) / record_size;
+    }
+
+    Keeper range;
+    size_t record_size;
+  };
 }
 }
 
@@ -0,0 +1,452 @@
+#ifndef EZY_TRANSDUCER_H_INCLUDED
+#define EZY_TRANSDUCER_H_INCLUDED
+
+#include <ezy/invoke.h>
+#include <ezy/pipe.h>
+#include <ezy/type_traits.h>
+#include <ezy/bits/internal_iteration.h>
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Transducers are processing stages (eg. `ezy::xf::map(f)`), which do not know where their elements come from.
+ * Composed by `ezy::pipe`, they are turned into a stack of reducers, which can run over a range
+ * (`ezy::transduce`), or be fed element by element from a push source (`ezy::make_transducer_sink`), without
+ * iterators or intermediate containers.
+ *
+ * A reducer is called with the accumulator and an element, and returns false if no more elements are needed
+ * (eg. after `xf::take`), so the producer can stop. `complete(acc)` is called at the end of the input, stages
+ * holding elements (eg. `xf::chunk`) pass them on then.
+ */
+namespace ezy
+{
+namespace detail
+{
+  /**
+   * The bottom of the reducer stack: `acc = rf(acc, element)`.
+   */
+  template <typename ReducingFunction>
+  struct xf_bottom_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    {
+      acc = ezy::invoke(rf, std::move(acc), std::forward<T>(t));
+      return true;
+    }
+
+    template <typename Acc>
+    constexpr void complete(Acc&)
+    {}
+
+    ReducingFunction rf;
+  };
+
+  template <typename Transducer>
+  struct xf_stages
+  {
+    using type = std::tuple<Transducer>;
+
+    static constexpr type get(const Transducer& xf)
+    { return type(xf); }
+  };
+
+  template <typename... Transducers>
+  struct xf_stages<ezy::piped<Transducers...>>
+  {
+    using type = decltype(std::tuple_cat(std::declval<typename xf_stages<ezy::remove_cvref_t<Transducers>>::type>()...));
+
+    static constexpr type get(const ezy::piped<Transducers...>& xf)
+    {
+      return std::apply([](const auto&... stages) {
+          return std::tuple_cat(xf_stages<ezy::remove_cvref_t<decltype(stages)>>::get(stages)...);
+        }, xf.fs);
+    }
+  };
+
+  /**
+   * Builds the reducer stack: each stage gets the element type of the previous stage, and wraps the reducer of
+   * the next one.
+   */
+  template <typename Input, size_t I, typename Stages, typename ReducingFunction>
+  constexpr auto make_reducer(const Stages& stages, const ReducingFunction& rf)
+  {
+    if constexpr (I == std::tuple_size_v<Stages>)
+    {
+      return xf_bottom_reducer<ReducingFunction>{rf};
+    }
+    else
+    {
+      const auto& stage = std::get<I>(stages);
+      using Output = typename ezy::remove_cvref_t<decltype(stage)>::template output_type<Input>;
+      return stage.template wrap<Input>(make_reducer<Output, I + 1>(stages, rf));
+    }
+  }
+
+  template <typename Input, typename Transducer, typename ReducingFunction>
+  constexpr auto make_reducer(const Transducer& xf, const ReducingFunction& rf)
+  {
+    using Stages = xf_stages<Transducer>;
+    return make_reducer<Input, 0>(Stages::get(xf), rf);
+  }
+
+  template <typename Fn, typename Next>
+  struct xf_map_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    { return next(acc, ezy::invoke(fn, std::forward<T>(t))); }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    Fn fn;
+    Next next;
+  };
+
+  template <typename Fn>
+  struct xf_map
+  {
+    template <typename Input>
+    using output_type = ezy::remove_cvref_t<decltype(ezy::invoke(std::declval<Fn&>(), std::declval<Input>()))>;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_map_reducer<Fn, Next>{fn, std::move(next)}; }
+
+    Fn fn;
+  };
+
+  template <typename Predicate, typename Next>
+  struct xf_filter_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    { return !ezy::invoke(pred, std::as_const(t)) || next(acc, std::forward<T>(t)); }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    Predicate pred;
+    Next next;
+  };
+
+  template <typename Predicate>
+  struct xf_filter
+  {
+    template <typename Input>
+    using output_type = Input;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_filter_reducer<Predicate, Next>{pred, std::move(next)}; }
+
+    Predicate pred;
+  };
+
+  template <typename Next>
+  struct xf_take_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    {
+      if (remaining == 0)
+        return false;
+
+      --remaining;
+      return next(acc, std::forward<T>(t)) && remaining != 0;
+    }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    size_t remaining;
+    Next next;
+  };
+
+  struct xf_take
+  {
+    template <typename Input>
+    using output_type = Input;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_take_reducer<Next>{n, std::move(next)}; }
+
+    size_t n;
+  };
+
+  template <typename Predicate, typename Next>
+  struct xf_take_while_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    { return ezy::invoke(pred, std::as_const(t)) && next(acc, std::forward<T>(t)); }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    Predicate pred;
+    Next next;
+  };
+
+  template <typename Predicate>
+  struct xf_take_while
+  {
+    template <typename Input>
+    using output_type = Input;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_take_while_reducer<Predicate, Next>{pred, std::move(next)}; }
+
+    Predicate pred;
+  };
+
+  template <typename Next>
+  struct xf_drop_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    {
+      if (remaining > 0)
+      {
+        --remaining;
+        return true;
+      }
+      return next(acc, std::forward<T>(t));
+    }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    size_t remaining;
+    Next next;
+  };
+
+  struct xf_drop
+  {
+    template <typename Input>
+    using output_type = Input;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_drop_reducer<Next>{n, std::move(next)}; }
+
+    size_t n;
+  };
+
+  /**
+   * The chunk is passed on as a const reference to the buffer, which is reused for the next chunk.
+   */
+  template <typename Value, typename Next>
+  struct xf_chunk_reducer
+  {
+    template <typename Acc, typename T>
+    bool operator()(Acc& acc, T&& t)
+    {
+      buffer.push_back(std::forward<T>(t));
+      if (buffer.size() < n)
+        return true;
+
+      const bool more = next(acc, std::as_const(buffer));
+      buffer.clear();
+      return more;
+    }
+
+    template <typename Acc>
+    void complete(Acc& acc)
+    {
+      if (!buffer.empty())
+      {
+        next(acc, std::as_const(buffer));
+        buffer.clear();
+      }
+      next.complete(acc);
+    }
+
+    size_t n;
+    Next next;
+    std::vector<Value> buffer{};
+  };
+
+  struct xf_chunk
+  {
+    template <typename Input>
+    using output_type = std::vector<ezy::remove_cvref_t<Input>>;
+
+    template <typename Input, typename Next>
+    auto wrap(Next next) const
+    {
+      xf_chunk_reducer<ezy::remove_cvref_t<Input>, Next> reducer{n, std::move(next)};
+      reducer.buffer.reserve(n);
+      return reducer;
+    }
+
+    size_t n;
+  };
+
+  template <typename Value, typename Next>
+  struct xf_dedupe_reducer
+  {
+    template <typename Acc, typename T>
+    constexpr bool operator()(Acc& acc, T&& t)
+    {
+      if (previous.has_value() && *previous == t)
+        return true;
+
+      previous = t;
+      return next(acc, std::forward<T>(t));
+    }
+
+    template <typename Acc>
+    constexpr void complete(Acc& acc)
+    { next.complete(acc); }
+
+    Next next;
+    std::optional<Value> previous{};
+  };
+
+  struct xf_dedupe
+  {
+    template <typename Input>
+    using output_type = Input;
+
+    template <typename Input, typename Next>
+    constexpr auto wrap(Next next) const
+    { return xf_dedupe_reducer<ezy::remove_cvref_t<Input>, Next>{std::move(next)}; }
+  };
+}
+
+namespace xf
+{
+  /**
+   * Transforms each element by `fn`.
+   */
+  template <typename Fn>
+  constexpr auto map(Fn&& fn)
+  { return detail::xf_map<ezy::remove_cvref_t<Fn>>{std::forward<Fn>(fn)}; }
+
+  /**
+   * Passes on the elements for which `pred` holds.
+   */
+  template <typename Predicate>
+  constexpr auto filter(Predicate&& pred)
+  { return detail::xf_filter<ezy::remove_cvref_t<Predicate>>{std::forward<Predicate>(pred)}; }
+
+  /**
+   * Passes on the first `n` elements, then stops the producer.
+   */
+  constexpr auto take(size_t n)
+  { return detail::xf_take{n}; }
+
+  /**
+   * Passes on the elements until `pred` does not hold, then stops the producer.
+   */
+  template <typename Predicate>
+  constexpr auto take_while(Predicate&& pred)
+  { return detail::xf_take_while<ezy::remove_cvref_t<Predicate>>{std::forward<Predicate>(pred)}; }
+
+  /**
+   * Skips the first `n` elements.
+   */
+  constexpr auto drop(size_t n)
+  { return detail::xf_drop{n}; }
+
+  /**
+   * Groups the elements by `n` into a `std::vector`, the last chunk may be shorter.
+   */
+  inline auto chunk(size_t n)
+  { return detail::xf_chunk{n}; }
+
+  /**
+   * Skips elements equal to the previous one.
+   */
+  constexpr auto dedupe()
+  { return detail::xf_dedupe{}; }
+}
+
+  /**
+   * Reduces the elements of `range` processed by the transducer `xf` (eg. `ezy::pipe(xf::map(f), xf::take(3))`)
+   * by `rf`, starting from `init`. The range is iterated by internal iteration, and stopped early if `xf`
+   * does not need more elements.
+   */
+  template <typename Range, typename Transducer, typename ReducingFunction, typename Init>
+  constexpr auto transduce(Range&& range, const Transducer& xf, ReducingFunction&& rf, Init&& init)
+  {
+    using std::begin;
+    using Input = decltype(*begin(range));
+    auto reducer = detail::make_reducer<Input>(xf, ezy::remove_cvref_t<ReducingFunction>(std::forward<ReducingFunction>(rf)));
+
+    std::decay_t<Init> acc(std::forward<Init>(init));
+    detail::for_each_until(range, [&](auto&& element) {
+        return reducer(acc, std::forward<decltype(element)>(element));
+    });
+    reducer.complete(acc);
+    return acc;
+  }
+
+  /**
+   * transducer_sink runs a reducer stack on elements pushed one by one, eg. from a receive callback.
+   */
+  template <typename Reducer, typename Acc>
+  struct transducer_sink
+  {
+    /**
+     * Returns false if no more elements are needed, further elements are ignored.
+     */
+    template <typename T>
+    constexpr bool operator()(T&& t)
+    {
+      if (!done)
+        done = !reducer(acc, std::forward<T>(t));
+      return !done;
+    }
+
+    constexpr bool is_done() const
+    { return done; }
+
+    /**
+     * The accumulator so far, the elements held by the stages (eg. a partial chunk) are not included.
+     */
+    constexpr const Acc& get() const
+    { return acc; }
+
+    /**
+     * Ends the input: the stages pass on the elements they hold, and the result is returned.
+     */
+    constexpr Acc complete() &&
+    {
+      reducer.complete(acc);
+      return std::move(acc);
+    }
+
+    Reducer reducer;
+    Acc acc;
+    bool done{false};
+  };
+
+  /**
+   * Creates a sink for elements of type `T`, eg.
+   * `auto sink = ezy::make_transducer_sink<packet>(ezy::pipe(xf::filter(valid), xf::take(10)), push_back, init)`.
+   */
+  template <typename T, typename Transducer, typename ReducingFunction, typename Init>
+  constexpr auto make_transducer_sink(const Transducer& xf, ReducingFunction&& rf, Init&& init)
+  {
+    auto reducer = detail::make_reducer<T>(xf, ezy::remove_cvref_t<ReducingFunction>(std::forward<ReducingFunction>(rf)));
+    return transducer_sink<decltype(reducer), std::decay_t<Init>>{std::move(reducer), std::forward<Init>(init)};
+  }
+}
+
+#endif
@@ -7,9 +7,15 @@
 #include <ezy/string.h>
 #include <ezy/experimental/function.h>
 #include <ezy/arithmetic.h>
+#include <ezy/math.h>
 
+#include <array>
 #include <vector>
 #include <list>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <sstream>
 
 #include "common.h"
 #include "join_as_strings.h"
@@ -97,6 +103,12 @@ namespace
   {
     return t.v;
   }
+
+  template <typename Range, typename = void>
+  struct is_const_iterable : std::false_type {};
+
+  template <typename Range>
+  struct is_const_iterable<Range, std::void_t<decltype(std::begin(std::declval<const Range&>()))>> : std::true_type {};
 }
 
 SCENARIO("empty")
@@ -172,6 +184,230 @@ SCENARIO("size")
   }
 }
 
+SCENARIO("size of views")
+{
+  const std::vector<int> v{1,2,3,4,5,6,7,8,9,10};
+  const std::list<int> l{1,2,3};
+
+  const auto check_size = [](const auto& range, size_t expected)
+  {
+    REQUIRE(range.size() == expected);
+    REQUIRE(ezy::size(range) == expected);
+    REQUIRE(static_cast<size_t>(std::distance(std::begin(range), std::end(range))) == expected);
+    REQUIRE(ezy::empty(range) == (expected == 0));
+  };
+
+  GIVEN("take")
+  {
+    check_size(ezy::take(v, 4), 4);
+    check_size(ezy::take(v, 15), 10);
+    check_size(ezy::take(v, 0), 0);
+  }
+
+  GIVEN("drop")
+  {
+    check_size(ezy::drop(v, 4), 6);
+    check_size(ezy::drop(v, 10), 0);
+    check_size(ezy::drop(v, 15), 0);
+  }
+
+  GIVEN("slice")
+  {
+    check_size(ezy::slice(v, 2, 5), 3);
+    check_size(ezy::slice(v, 8, 15), 2);
+    check_size(ezy::slice(v, 12, 15), 0);
+  }
+
+  GIVEN("chunk")
+  {
+    check_size(ezy::chunk(v, 3), 4);
+    check_size(ezy::chunk(v, 5), 2);
+    check_size(ezy::chunk(std::vector<int>{}, 5), 0);
+  }
+
+  GIVEN("step_by")
+  {
+    check_size(ezy::step_by(v, 3), 4);
+    check_size(ezy::step_by(v, 5), 2);
+    check_size(ezy::step_by(v, 11), 1);
+  }
+
+  GIVEN("zip")
+  {
+    check_size(ezy::zip(v, l), 3);
+    check_size(ezy::zip(v, ezy::take(v, 7)), 7);
+  }
+
+  GIVEN("concatenate")
+  {
+    check_size(ezy::concatenate(v, l), 13);
+    check_size(ezy::concatenate(l, std::vector<int>{}), 3);
+  }
+
+  GIVEN("nested views")
+  {
+    check_size(ezy::take(ezy::drop(ezy::slice(v, 1, 9), 2), 3), 3);
+  }
+
+  GIVEN("a view of an infinite range")
+  {
+    const auto taken = ezy::take(ezy::iterate(1), 4);
+    static_assert(!ezy::detail::has_member_size<decltype(taken)>::value);
+    REQUIRE(ezy::size(ezy::take(taken, 2)) == 2);
+  }
+}
+
+SCENARIO("size hints of views")
+{
+  const std::vector<int> v{1,2,3,4,5,6,7,8,9,10};
+  const auto is_even = [](int i) { return i % 2 == 0; };
+
+  const auto check_hint = [](const auto& range, size_t lower, std::optional<size_t> upper)
+  {
+    const auto hint = ezy::detail::size_hint(range);
+    REQUIRE(hint.lower == lower);
+    REQUIRE(hint.upper == upper);
+  };
+
+  GIVEN("exact hints")
+  {
+    check_hint(v, 10, 10);
+    check_hint(ezy::transform(v, is_even), 10, 10);
+    check_hint(ezy::zip(v, ezy::take(v, 4)), 4, 4);
+    check_hint(ezy::slice(std::list<int>{1, 2, 3, 4}, 1, 3), 2, 2);
+    check_hint(ezy::flatten(std::vector<std::array<int, 2>>{{1, 2}, {3, 4}, {5, 6}}), 6, 6);
+    check_hint(ezy::concatenate(v, ezy::transform(v, is_even)), 20, 20);
+  }
+
+  GIVEN("upper bounds")
+  {
+    check_hint(ezy::filter(v, is_even), 0, 10);
+    check_hint(ezy::take_while(v, is_even), 0, 10);
+    check_hint(ezy::drop_while(v, is_even), 0, 10);
+    check_hint(ezy::take(ezy::filter(v, is_even), 3), 0, 3);
+    check_hint(ezy::transform(ezy::filter(v, is_even), is_even), 0, 10);
+    check_hint(ezy::concatenate(v, ezy::filter(v, is_even)), 10, 20);
+  }
+
+  GIVEN("flattened ranges")
+  {
+    check_hint(ezy::flatten(std::vector<std::vector<int>>{{1, 2}, {}, {3}}), 0, std::nullopt);
+
+    int calls = 0;
+    const auto flattened = ezy::flatten(ezy::transform(v, [&calls](int i) { ++calls; return std::vector<int>{i, i}; }));
+    check_hint(flattened, 0, std::nullopt);
+    REQUIRE(calls == 0);
+    REQUIRE(ezy::collect<std::vector<int>>(flattened).size() == 20);
+    REQUIRE(calls == 10);
+  }
+
+  GIVEN("infinite ranges")
+  {
+    check_hint(ezy::iterate(1), 0, std::nullopt);
+    check_hint(ezy::take(ezy::iterate(1), 5), 0, 5);
+    check_hint(ezy::zip(ezy::iterate(1), v), 0, 10);
+  }
+}
+
+namespace
+{
+  size_t allocation_count = 0;
+
+  template <typename T>
+  struct counting_allocator
+  {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(size_t n)
+    {
+      ++allocation_count;
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+      std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) { return true; }
+    friend bool operator!=(const counting_allocator&, const counting_allocator&) { return false; }
+  };
+
+  using counted_vector = std::vector<int, counting_allocator<int>>;
+}
+
+SCENARIO("collect allocates once if the size is known or bounded")
+{
+  std::vector<int> v(1'000'000);
+  std::iota(v.begin(), v.end(), 0);
+
+  GIVEN("a mapped vector")
+  {
+    allocation_count = 0;
+    const auto result = ezy::collect<counted_vector>(ezy::transform(v, [](int i) { return i * 2; }));
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.size() == 1'000'000);
+    REQUIRE(result.back() == 1'999'998);
+  }
+
+  GIVEN("a flattened vector of arrays")
+  {
+    const std::vector<std::array<int, 1000>> nested(1000);
+    allocation_count = 0;
+    const auto result = ezy::collect<counted_vector>(ezy::flatten(nested));
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.size() == 1'000'000);
+  }
+
+  GIVEN("a concatenation")
+  {
+    const std::list<int> l{1, 2, 3};
+    allocation_count = 0;
+    const auto result = ezy::collect<counted_vector>(ezy::concatenate(v, l));
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.size() == 1'000'003);
+  }
+
+  GIVEN("a filter over a short range")
+  {
+    const std::vector<int> short_v(1000, 1);
+    allocation_count = 0;
+    const auto result = ezy::collect<counted_vector>(ezy::filter(short_v, [](int i) { return i > 0; }));
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.size() == 1000);
+  }
+
+  GIVEN("a few elements taken of a filter")
+  {
+    allocation_count = 0;
+    const auto result = ezy::collect<counted_vector>(ezy::take(ezy::filter(v, [](int i) { return i % 2 == 0; }), 100));
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.capacity() == 100);
+  }
+
+  GIVEN("a filter over a long range")
+  {
+    const auto result = ezy::collect<counted_vector>(ezy::filter(v, [](int i) { return i < 10; }));
+    REQUIRE(result.size() == 10);
+    REQUIRE(result.capacity() < v.size());
+  }
+
+  GIVEN("an extended type")
+  {
+    using Numbers = ezy::extended_type<std::vector<int>, ezy::features::iterable>;
+    const Numbers numbers(std::vector<int>(1000, 2));
+    allocation_count = 0;
+    const auto result = numbers.map([](int i) { return i + 1; }).to<counted_vector>();
+    REQUIRE(allocation_count == 1);
+    REQUIRE(result.size() == 1000);
+  }
+}
+
 SCENARIO("at")
 {
   GIVEN("a vector")
@@ -374,6 +610,67 @@ SCENARIO("join string_views")
   REQUIRE(ezy::join<std::string>(v, ":") == "a:b:c");
 }
 
+SCENARIO("join allocates once if the lengths are known")
+{
+  using counted_string = std::basic_string<char, std::char_traits<char>, counting_allocator<char>>;
+  const std::vector<std::string> v(100, std::string(50, 'x'));
+
+  GIVEN("a vector of strings")
+  {
+    allocation_count = 0;
+    const auto joined = ezy::join<counted_string>(v, ", ");
+    REQUIRE(joined.size() == 100 * 50 + 99 * 2);
+    REQUIRE(allocation_count == 1);
+  }
+
+  GIVEN("a buffer reused by join_append")
+  {
+    counted_string buffer;
+    buffer.reserve(1000);
+    ezy::join_append(buffer, v, ", ");
+    buffer.clear();
+
+    allocation_count = 0;
+    ezy::join_append(buffer, v, ", ");
+    REQUIRE(buffer.size() == 100 * 50 + 99 * 2);
+    REQUIRE(allocation_count == 0);
+  }
+}
+
+SCENARIO("join_append")
+{
+  std::vector<std::string> v{"a", "b", "c"};
+  std::string buffer{"abc: "};
+  REQUIRE(ezy::join_append(buffer, v, "+") == "abc: a+b+c");
+  REQUIRE(ezy::join_append(buffer, std::vector<std::string>{}, "+") == "abc: a+b+c");
+}
+
+SCENARIO("join_into")
+{
+  GIVEN("strings")
+  {
+    std::vector<std::string> v{"a", "bc", "d"};
+    std::string result;
+    ezy::join_into(v, std::back_inserter(result), ", ");
+    REQUIRE(result == "a, bc, d");
+  }
+
+  GIVEN("characters")
+  {
+    std::string result;
+    ezy::join_into(ezy::range('a', 'e'), std::back_inserter(result), '-');
+    REQUIRE(result == "a-b-c-d");
+  }
+
+  GIVEN("an empty range")
+  {
+    std::vector<std::string> v{};
+    std::string result;
+    ezy::join_into(v, std::back_inserter(result), ", ");
+    REQUIRE(result.empty());
+  }
+}
+
 SCENARIO("transform")
 {
   std::vector<int> v{1,2,3};
@@ -382,6 +679,53 @@ SCENARIO("transform")
   REQUIRE(join_as_strings(mapped) == "234");
 }
 
+SCENARIO("transform by a mutable function")
+{
+  const std::vector<int> v{1, 2, 3};
+  const auto numbered = ezy::transform(v, [n = 0](int i) mutable { return i * 10 + n++; });
+  std::string result;
+  for (int i : numbered)
+    result += std::to_string(i) + ",";
+  REQUIRE(result == "10,21,32,");
+  REQUIRE(ezy::accumulate(numbered, 0) == 63);
+}
+
+SCENARIO("transform keeps random access")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8};
+  const auto mapped = ezy::transform(v, [](int i) { return i * 10; });
+
+  using Iterator = decltype(std::begin(mapped));
+  static_assert(std::is_same_v<std::iterator_traits<Iterator>::iterator_category, std::random_access_iterator_tag>);
+  static_assert(std::is_same_v<std::iterator_traits<Iterator>::value_type, int>);
+
+  REQUIRE(ezy::size(mapped) == 8);
+  REQUIRE(mapped.size() == 8);
+  REQUIRE(!ezy::empty(mapped));
+  REQUIRE(ezy::empty(ezy::transform(std::vector<int>{}, [](int i) { return i; })));
+
+  auto it = std::begin(mapped);
+  REQUIRE(it[3] == 40);
+  REQUIRE(*(it + 5) == 60);
+  REQUIRE(*(2 + it) == 30);
+  REQUIRE(std::end(mapped) - it == 8);
+  REQUIRE(it < std::end(mapped));
+
+  it += 7;
+  REQUIRE(*it == 80);
+  it -= 2;
+  REQUIRE(*it-- == 60);
+  REQUIRE(*it == 50);
+
+  const auto found = std::lower_bound(std::begin(mapped), std::end(mapped), 45);
+  REQUIRE(found - std::begin(mapped) == 4);
+  REQUIRE(*found == 50);
+
+  REQUIRE(ezy::index(mapped, 6) == 70);
+  REQUIRE(*ezy::checked_index(mapped, 7) == 80);
+  REQUIRE(!ezy::checked_index(mapped, 8).has_value());
+}
+
 SCENARIO("filter")
 {
   std::vector<int> v{1,2,3,4,5,6};
@@ -408,6 +752,116 @@ SCENARIO("filter mutable")
   REQUIRE(join_as_strings(v, ",") == "1,4,3,8,5,12");
 }
 
+SCENARIO("filter finds its first element once")
+{
+  const std::vector<int> v{1, 3, 5, 7, 8, 9, 10};
+  int calls = 0;
+  auto filtered = ezy::filter(v, [&calls](int i) { ++calls; return i % 2 == 0; });
+  REQUIRE(calls == 0);
+
+  REQUIRE(*std::begin(filtered) == 8);
+  REQUIRE(calls == 5);
+  REQUIRE(*std::begin(filtered) == 8);
+  REQUIRE(calls == 5);
+  REQUIRE(join_as_strings(filtered) == "810");
+
+  WHEN("the view is copied")
+  {
+    auto copy = filtered;
+    calls = 0;
+    REQUIRE(*std::begin(copy) == 8);
+    REQUIRE(calls == 5);
+  }
+
+  WHEN("the view is accessed as const")
+  {
+    const auto& const_filtered = filtered;
+    calls = 0;
+    REQUIRE(*std::begin(const_filtered) == 8);
+    REQUIRE(*std::begin(const_filtered) == 8);
+    THEN("nothing is cached, so concurrent access is safe")
+    {
+      REQUIRE(calls == 10);
+    }
+  }
+}
+
+SCENARIO("iterators do not copy the functors of their views")
+{
+  using source_iterator = std::vector<int>::const_iterator;
+  const std::vector<int> v{1, 2, 3, 4, 5, 6};
+
+  GIVEN("a stateless function")
+  {
+    const auto twice = [](int i) { return i * 2; };
+    const auto even = [](int i) { return i % 2 == 0; };
+
+    const auto mapped = ezy::transform(v, twice);
+    static_assert(sizeof(std::begin(mapped)) == sizeof(source_iterator));
+
+    const auto filtered = ezy::filter(ezy::transform(v, twice), even);
+    static_assert(sizeof(std::begin(filtered)) <= 2 * sizeof(void*) + sizeof(source_iterator));
+    REQUIRE(join_as_strings(filtered) == "24681012");
+
+    const auto taken = ezy::take_while(v, even);
+    static_assert(sizeof(std::begin(taken)) == sizeof(ezy::detail::range_tracker<const std::vector<int>>));
+
+    const auto dropped = ezy::drop_while(v, even);
+    static_assert(sizeof(std::begin(dropped)) == sizeof(ezy::detail::range_tracker<const std::vector<int>>));
+
+    const auto iterated = ezy::iterate(1, twice);
+    static_assert(sizeof(std::begin(iterated)) == sizeof(int));
+  }
+
+  GIVEN("a function with a large state")
+  {
+    const std::array<int, 16> table{};
+    const auto lookup = [table](int i) { return table[static_cast<size_t>(i)] + i; };
+    const auto below = [table](int i) { return table[0] + i < 4; };
+
+    const auto mapped = ezy::transform(v, lookup);
+    static_assert(sizeof(std::begin(mapped)) == sizeof(void*) + sizeof(source_iterator));
+    REQUIRE(join_as_strings(mapped) == "123456");
+
+    const auto taken = ezy::take_while(v, below);
+    static_assert(sizeof(std::begin(taken)) == sizeof(void*) + sizeof(ezy::detail::range_tracker<const std::vector<int>>));
+    REQUIRE(join_as_strings(taken) == "123");
+
+    WHEN("the view is copied")
+    {
+      const auto copy = mapped;
+      REQUIRE(join_as_strings(copy) == "123456");
+    }
+  }
+
+  GIVEN("a mutable function")
+  {
+    const auto counting_below = [calls = 0](int i) mutable { ++calls; return i < 4; };
+    std::string result;
+
+    const auto filtered = ezy::filter(v, counting_below);
+    for (int i : filtered)
+      result += std::to_string(i);
+    REQUIRE(ezy::accumulate(filtered, 0) == 6);
+
+    const auto taken = ezy::take_while(v, counting_below);
+    for (int i : taken)
+      result += std::to_string(i);
+
+    const auto iterated = ezy::iterate(1, [calls = 0](int i) mutable { ++calls; return i + 1; });
+    for (int i : ezy::take(iterated, 3))
+      result += std::to_string(i);
+
+    REQUIRE(result == "123123123");
+  }
+
+  GIVEN("views without functors")
+  {
+    static_assert(sizeof(std::begin(ezy::drop(v, 2))) == sizeof(source_iterator));
+    static_assert(sizeof(std::begin(ezy::take(v, 2))) == sizeof(source_iterator));
+  }
+}
+
 SCENARIO("concatenate")
 {
   std::vector<int> v1{1,2,3};
@@ -444,6 +898,53 @@ SCENARIO("concatenate - on array")
   REQUIRE(join_as_strings(concatenated) == "123456");
 }
 
+SCENARIO("concatenate - more ranges")
+{
+  GIVEN("ranges of different types")
+  {
+    const std::vector<int> v{1, 2};
+    const std::list<int> l{3, 4};
+    int a[] = {5, 6};
+    const auto concatenated = ezy::concatenate(v, l, a, std::vector{7, 8, 9});
+    REQUIRE(join_as_strings(concatenated) == "123456789");
+    REQUIRE(concatenated.size() == 9);
+  }
+
+  GIVEN("empty ranges among them")
+  {
+    const std::vector<int> empty;
+    const std::vector<int> v{1, 2};
+    const auto concatenated = ezy::concatenate(empty, v, empty, empty, v, empty);
+    REQUIRE(join_as_strings(concatenated) == "1212");
+    REQUIRE(std::distance(concatenated.begin(), concatenated.end()) == 4);
+  }
+
+  GIVEN("only empty ranges")
+  {
+    const std::vector<int> empty;
+    const auto concatenated = ezy::concatenate(empty, empty, empty);
+    REQUIRE(concatenated.begin() == concatenated.end());
+    REQUIRE(ezy::accumulate(concatenated, 0) == 0);
+  }
+
+  GIVEN("a single range")
+  {
+    const auto concatenated = ezy::concatenate(std::vector{1, 2, 3});
+    REQUIRE(join_as_strings(concatenated) == "123");
+  }
+
+  GIVEN("a mutable range")
+  {
+    std::vector<int> v1{1, 2};
+    std::vector<int> v2{3};
+    auto concatenated = ezy::concatenate(v1, v2);
+    for (auto& e : concatenated)
+      e *= 10;
+    REQUIRE(v1 == std::vector{10, 20});
+    REQUIRE(v2 == std::vector{30});
+  }
+}
+
 template <typename Zipped>
 auto join_zipped(Zipped&& zipped)
 {
@@ -594,6 +1095,32 @@ SCENARIO("slice works in compile time")
   static_assert(ezy::accumulate(sliced, 0) == (3 + 4));
 }
 
+SCENARIO("slice on list")
+{
+  std::list<int> l{1,2,3,4,5,6,7,8};
+  REQUIRE(join_as_strings(ezy::slice(l, 2, 5)) == "345");
+  REQUIRE(join_as_strings(ezy::slice(l, 6, 12)) == "78");
+  REQUIRE(join_as_strings(ezy::slice(l, 10, 12)) == "");
+  REQUIRE(join_as_strings(ezy::slice(ezy::slice(l, 1, 7), 2, 4)) == "45");
+}
+
+SCENARIO("slice of a temporary list survives copying")
+{
+  auto sliced = ezy::slice(std::list<int>{1,2,3,4,5,6,7,8}, 3, 6);
+  REQUIRE(join_as_strings(sliced) == "456");
+  const auto moved = std::move(sliced);
+  REQUIRE(join_as_strings(moved) == "456");
+}
+
+SCENARIO("slice of a slice of a vector")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8,9,10};
+  const auto sliced = ezy::slice(ezy::slice(v, 2, 9), 1, 5);
+  REQUIRE(&*std::begin(sliced) == &v[3]);
+  REQUIRE(&*std::end(sliced) == &v[7]);
+  REQUIRE(join_as_strings(sliced) == "4567");
+}
+
 SCENARIO("all_of")
 {
   int a[] = {0, 1, 2, 3, 4, 5};
@@ -777,64 +1304,379 @@ SCENARIO("drop_while")
   }
 }
 
-SCENARIO("step_by")
+SCENARIO("drop and drop_while walk the prefix once")
 {
-  auto remaining = ezy::step_by(ezy::iterate(0), 3);
-  REQUIRE(join_as_strings(ezy::take(remaining, 5), ",") == "0,3,6,9,12");
-}
+  std::list<int> l{1, 2, 3, 4, 5};
 
-SCENARIO("step_by mutating")
-{
-  std::vector<int> v{1,2,3,4,5,6,7};
-  auto remaining = ezy::step_by(v, 3);
-  *(std::next(remaining.begin())) += 10;
-  REQUIRE(join_as_strings(remaining, ",") == "1,14,7");
-}
+  GIVEN("drop")
+  {
+    const auto dropped = ezy::drop(l, 2);
+    REQUIRE(*std::begin(dropped) == 3);
+    REQUIRE(join_as_strings(dropped) == "345");
+  }
 
-SCENARIO("step_by works on array")
-{
-  int a[] = {1,2,3,4,5,6,7,8};
-  REQUIRE(join_as_strings(ezy::step_by(a, 3), ",") == "1,4,7");
-}
+  GIVEN("drop_while")
+  {
+    int calls = 0;
+    auto dropped = ezy::drop_while(l, [&calls](int i) { ++calls; return i < 3; });
+    REQUIRE(*std::begin(dropped) == 3);
+    REQUIRE(*std::begin(dropped) == 3);
+    REQUIRE(calls == 3);
 
-SCENARIO("flatten")
-{
-  std::vector<std::vector<int>> v{std::vector{1,2,3,4,5,6,7,8}, {}, std::vector{0,0,0}};
-  REQUIRE(join_as_strings(ezy::flatten(v)) == "12345678000");
-}
+    calls = 0;
+    REQUIRE(*std::begin(std::as_const(dropped)) == 3);
+    REQUIRE(calls == 3);
+  }
 
-SCENARIO("find_element")
-{
-  std::vector<int> v{1,2,3,4,5,6,7,8};
-  const auto found = ezy::find_element(v, 5);
-  REQUIRE(found != std::end(v));
-  REQUIRE(*found == 5);
+  GIVEN("drop_while on an empty range")
+  {
+    const auto dropped = ezy::drop_while(std::vector<int>{}, [](int) { return true; });
+    REQUIRE(std::begin(dropped) == std::end(dropped));
+  }
 
-  const auto not_found = ezy::find_element(v, 9);
-  REQUIRE(not_found == std::end(v));
+  GIVEN("mutable access")
+  {
+    auto dropped = ezy::drop_while(l, [](int i) { return i < 3; });
+    *std::begin(dropped) = 0;
+    REQUIRE(join_as_strings(l) == "12045");
+  }
 }
 
-SCENARIO("find_element in temporary should not compile")
+SCENARIO("pipeline fusion")
 {
-  //const auto found = ezy::find_element(std::vector{1,2,3,4,5,6,7,8}, 5);
-  // > "Range must be a reference! Cannot form an iterator to a temporary!"
-}
+  const std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  const auto twice = [](int i) { return i * 2; };
+  const auto plus_one = [](int i) { return i + 1; };
 
-SCENARIO("find")
-{
-  std::vector<int> v{1,2,3,4,5,6,7,8};
-  const auto found = ezy::find(v, 5);
-  REQUIRE(found.has_value());
-  REQUIRE(found.value() == 5); // this should be a reference
+  GIVEN("adjacent transformations")
+  {
+    const auto transformed = ezy::transform(ezy::transform(v, twice), plus_one);
+    using view_type = ezy::remove_cvref_t<decltype(transformed)>;
+    static_assert(std::is_same_v<typename view_type::_orig_const_iterator, std::vector<int>::const_iterator>);
+    REQUIRE(join_as_strings(transformed, ",") == "3,5,7,9,11,13,15,17,19,21");
 
-  const auto not_found = ezy::find(v, 9);
-  REQUIRE(!not_found.has_value());
-}
+    const auto three_times = ezy::transform(ezy::transform(ezy::transform(v, twice), plus_one), twice);
+    REQUIRE(ezy::accumulate(three_times, 0) == 240);
+  }
 
-SCENARIO("find returns reference-like")
-{
-  std::vector<int> v{1,2,3,4,5,6,7,8};
-  const auto found = ezy::find(v, 5);
+  GIVEN("adjacent transformations by lvalue functions")
+  {
+    std::function<int(int)> negate = [](int i) { return -i; };
+    const auto transformed = ezy::transform(ezy::transform(v, negate), negate);
+    REQUIRE(join_as_strings(transformed) == "12345678910");
+  }
+
+  GIVEN("adjacent filters")
+  {
+    int second_calls = 0;
+    const auto filtered = ezy::filter(ezy::filter(v, [](int i) { return i % 2 == 0; }),
+        [&second_calls](int i) { ++second_calls; return i > 4; });
+    using view_type = ezy::remove_cvref_t<decltype(filtered)>;
+    static_assert(std::is_same_v<typename view_type::const_iterator::value_type, int>);
+    static_assert(std::is_same_v<typename view_type::Range, const std::vector<int>>);
+    REQUIRE(join_as_strings(filtered, ",") == "6,8,10");
+    REQUIRE(second_calls == 5);
+  }
+
+  GIVEN("adjacent filters taking non-const references")
+  {
+    std::vector<int> mutable_v{1, 2, 3, 4, 5};
+    auto filtered = ezy::filter(ezy::filter(mutable_v, [](int& i) { return i > 1; }), [](int& i) { return i < 5; });
+    REQUIRE(ezy::accumulate(filtered, 0) == 9);
+  }
+
+  GIVEN("adjacent filters with a mutable predicate")
+  {
+    auto filtered = ezy::filter(ezy::filter(v, [calls = 0](int i) mutable { ++calls; return i > 1; }),
+        [](int i) { return i < 5; });
+    int sum = 0;
+    for (int i : filtered)
+      sum += i;
+    REQUIRE(sum == 9);
+  }
+
+  GIVEN("const pipelines with mutable functions")
+  {
+    const auto filtered = ezy::filter(ezy::filter(v, [calls = 0](int i) mutable { ++calls; return i > 1; }),
+        [](int i) { return i < 5; });
+    REQUIRE(ezy::accumulate(filtered, 0) == 9);
+
+    const auto transformed = ezy::transform(ezy::transform(v, [calls = 0](int i) mutable { ++calls; return i; }), twice);
+    REQUIRE(ezy::accumulate(transformed, 0) == 110);
+
+    const auto taken = ezy::take_while(v, [calls = 0](int i) mutable { ++calls; return i < 4; });
+    REQUIRE(ezy::accumulate(taken, 0) == 6);
+  }
+
+  GIVEN("take at the end of a pipeline")
+  {
+    int calls = 0;
+    const auto counted = [&calls](int i) { ++calls; return i; };
+    const auto pipeline = ezy::take(ezy::filter(ezy::transform(v, counted), [](int i) { return i % 3 == 0; }), 2);
+    REQUIRE(ezy::accumulate(pipeline, 0) == 9);
+    REQUIRE(calls == 6);
+    REQUIRE(ezy::collect<std::vector<int>>(pipeline) == std::vector{3, 6});
+    REQUIRE(ezy::accumulate(ezy::take(ezy::filter(v, [](int) { return true; }), 0), 0) == 0);
+  }
+
+  GIVEN("take_while at the end of a pipeline")
+  {
+    const auto pipeline = ezy::take_while(ezy::transform(v, twice), [](int i) { return i < 9; });
+    REQUIRE(ezy::accumulate(pipeline, 0) == 20);
+  }
+
+  GIVEN("take and take_while over a mutable range")
+  {
+    std::list<int> l{1, 2, 3, 4, 5};
+    const auto odd = [](int i) { return i % 2 == 1; };
+
+    ezy::for_each(ezy::take(ezy::filter(l, odd), 2), [](int& i) { i = 0; });
+    REQUIRE(join_as_strings(l) == "02045");
+
+    ezy::for_each(ezy::take_while(l, [](int i) { return i < 4; }), [](int& i) { i += 1; });
+    REQUIRE(join_as_strings(l) == "13145");
+  }
+
+  GIVEN("an extended range")
+  {
+    const auto pipeline = ezy::make_extended<ezy::features::iterable>(v)
+      .map(twice)
+      .filter([](int i) { return i % 3 != 0; })
+      .map(plus_one)
+      .filter([](int i) { return i > 5; })
+      .map(twice)
+      .take(3);
+
+    REQUIRE(join_as_strings(pipeline, ",") == "18,22,30");
+    REQUIRE(pipeline.accumulate(0) == 70);
+  }
+}
+
+SCENARIO("drop on random access ranges")
+{
+  std::vector<int> v{1, 2, 3, 4, 5};
+
+  GIVEN("a drop shorter than the range")
+  {
+    auto dropped = ezy::drop(v, 2);
+    using iterator_category = typename std::iterator_traits<decltype(dropped.begin())>::iterator_category;
+    static_assert(std::is_same_v<iterator_category, std::random_access_iterator_tag>);
+    REQUIRE(dropped.begin() == v.begin() + 2);
+    REQUIRE(dropped.size() == 3);
+    REQUIRE(dropped.data() == v.data() + 2);
+    *dropped.begin() = 0;
+    REQUIRE(join_as_strings(v) == "12045");
+  }
+
+  GIVEN("a drop longer than the range")
+  {
+    const auto dropped = ezy::drop(v, 10);
+    REQUIRE(dropped.begin() == v.end());
+    REQUIRE(dropped.size() == 0);
+  }
+
+  GIVEN("a column of a matrix")
+  {
+    const std::vector<int> matrix{0, 1, 2, 10, 11, 12};
+    REQUIRE(join_as_strings(ezy::step_by(ezy::drop(matrix, 1), 3), ",") == "1,11");
+  }
+}
+
+SCENARIO("take_while_sorted and drop_while_sorted")
+{
+  const std::vector<int> timestamps{10, 20, 20, 30, 40, 50};
+  const auto before = [](int limit) { return [limit](int t) { return t < limit; }; };
+
+  GIVEN("drop_while_sorted")
+  {
+    int calls = 0;
+    auto dropped = ezy::drop_while_sorted(timestamps, [&calls](int t) { ++calls; return t < 30; });
+    REQUIRE(dropped.begin() == timestamps.begin() + 3);
+    REQUIRE(dropped.begin() == timestamps.begin() + 3);
+    REQUIRE(calls <= 3);
+    REQUIRE(dropped.size() == 3);
+
+    calls = 0;
+    REQUIRE(join_as_strings(std::as_const(dropped), ",") == "30,40,50");
+    REQUIRE(calls <= 3);
+  }
+
+  GIVEN("take_while_sorted")
+  {
+    const auto taken = ezy::take_while_sorted(timestamps, before(30));
+    REQUIRE(join_as_strings(taken, ",") == "10,20,20");
+    REQUIRE(taken.size() == 3);
+  }
+
+  GIVEN("a time range")
+  {
+    const auto trimmed = ezy::take_while_sorted(ezy::drop_while_sorted(timestamps, before(20)), before(45));
+    REQUIRE(join_as_strings(trimmed, ",") == "20,20,30,40");
+    REQUIRE(join_as_strings(ezy::take_while_sorted(timestamps, before(0))) == "");
+    REQUIRE(join_as_strings(ezy::drop_while_sorted(timestamps, before(100))) == "");
+  }
+
+  GIVEN("a forward range")
+  {
+    std::list<int> l{1, 2, 3, 4, 5};
+    auto dropped = ezy::drop_while_sorted(l, [](int i) { return i < 3; });
+    *std::begin(dropped) = 0;
+    REQUIRE(join_as_strings(l) == "12045");
+  }
+
+  GIVEN("an extended range")
+  {
+    const auto trimmed = ezy::make_extended<ezy::features::iterable>(timestamps)
+      .drop_while_sorted(before(20))
+      .take_while_sorted(before(45));
+    REQUIRE(join_as_strings(trimmed, ",") == "20,20,30,40");
+  }
+}
+
+SCENARIO("step_by")
+{
+  auto remaining = ezy::step_by(ezy::iterate(0), 3);
+  REQUIRE(join_as_strings(ezy::take(remaining, 5), ",") == "0,3,6,9,12");
+}
+
+SCENARIO("step_by mutating")
+{
+  std::vector<int> v{1,2,3,4,5,6,7};
+  auto remaining = ezy::step_by(v, 3);
+  *(std::next(remaining.begin())) += 10;
+  REQUIRE(join_as_strings(remaining, ",") == "1,14,7");
+}
+
+SCENARIO("step_by works on array")
+{
+  int a[] = {1,2,3,4,5,6,7,8};
+  REQUIRE(join_as_strings(ezy::step_by(a, 3), ",") == "1,4,7");
+}
+
+SCENARIO("step_by random access")
+{
+  GIVEN("a vector")
+  {
+    std::vector<int> v{0,1,2,3,4,5,6,7,8,9};
+    auto stepped = ezy::step_by(v, 3);
+    using iterator_category = typename std::iterator_traits<decltype(stepped.begin())>::iterator_category;
+    static_assert(std::is_same_v<iterator_category, std::random_access_iterator_tag>);
+
+    THEN("it has closed form size and can be indexed")
+    {
+      REQUIRE(stepped.size() == 4);
+      REQUIRE(stepped[0] == 0);
+      REQUIRE(stepped[3] == 9);
+      REQUIRE(stepped.end() - stepped.begin() == 4);
+      REQUIRE(*(stepped.begin() + 2) == 6);
+      REQUIRE(*std::prev(stepped.end()) == 9);
+    }
+
+    THEN("steps do not overrun the end")
+    {
+      REQUIRE(ezy::step_by(v, 9).size() == 2);
+      REQUIRE(ezy::step_by(v, 10).size() == 1);
+      REQUIRE(ezy::step_by(v, 100).size() == 1);
+      REQUIRE(join_as_strings(ezy::step_by(v, 100), ",") == "0");
+    }
+
+    THEN("empty range has no steps")
+    {
+      std::vector<int> empty;
+      REQUIRE(ezy::step_by(empty, 3).size() == 0);
+      REQUIRE(join_as_strings(ezy::step_by(empty, 3), ",") == "");
+    }
+  }
+}
+
+SCENARIO("strided")
+{
+  GIVEN("a row-major matrix of 3 rows and 4 columns")
+  {
+    std::vector<int> matrix{
+      0, 1, 2, 3,
+      10, 11, 12, 13,
+      20, 21, 22, 23
+    };
+    const size_t columns = 4;
+    const size_t rows = 3;
+
+    WHEN("a column is taken")
+    {
+      auto column = ezy::strided(matrix.data() + 1, columns, rows);
+
+      THEN("its elements are visited")
+      {
+        REQUIRE(column.size() == 3);
+        REQUIRE(join_as_strings(column, ",") == "1,11,21");
+        REQUIRE(column[2] == 21);
+      }
+
+      THEN("the matrix can be modified through it")
+      {
+        for (int& e : column)
+          e = -e;
+        REQUIRE(matrix[5] == -11);
+        REQUIRE(join_as_strings(ezy::strided(matrix.data() + 1, columns, rows), ",") == "-1,-11,-21");
+      }
+    }
+
+    WHEN("the diagonal is taken")
+    {
+      auto diagonal = ezy::strided(matrix.cbegin(), columns + 1, rows);
+      REQUIRE(join_as_strings(diagonal, ",") == "0,11,22");
+    }
+  }
+}
+
+SCENARIO("flatten")
+{
+  std::vector<std::vector<int>> v{std::vector{1,2,3,4,5,6,7,8}, {}, std::vector{0,0,0}};
+  REQUIRE(join_as_strings(ezy::flatten(v)) == "12345678000");
+}
+
+SCENARIO("flatten subranges computed by a transformation")
+{
+  const std::vector<int> v{1, 2, 3};
+  auto flattened = ezy::flatten(ezy::transform(v, [](int i) { return std::vector<int>(static_cast<size_t>(i), i); }));
+  int sum = 0;
+  ezy::for_each(flattened, [&sum](int i) { sum += i; });
+  REQUIRE(sum == 14);
+  REQUIRE(ezy::accumulate(std::as_const(flattened), 0) == 14);
+}
+
+SCENARIO("find_element")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8};
+  const auto found = ezy::find_element(v, 5);
+  REQUIRE(found != std::end(v));
+  REQUIRE(*found == 5);
+
+  const auto not_found = ezy::find_element(v, 9);
+  REQUIRE(not_found == std::end(v));
+}
+
+SCENARIO("find_element in temporary should not compile")
+{
+  //const auto found = ezy::find_element(std::vector{1,2,3,4,5,6,7,8}, 5);
+  // > "Range must be a reference! Cannot form an iterator to a temporary!"
+}
+
+SCENARIO("find")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8};
+  const auto found = ezy::find(v, 5);
+  REQUIRE(found.has_value());
+  REQUIRE(found.value() == 5); // this should be a reference
+
+  const auto not_found = ezy::find(v, 9);
+  REQUIRE(!not_found.has_value());
+}
+
+SCENARIO("find returns reference-like")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8};
+  const auto found = ezy::find(v, 5);
   REQUIRE(found.has_value());
   REQUIRE(found.value() == 5);
   v[4] += 10;
@@ -946,6 +1788,12 @@ SCENARIO("accumulate")
 
   REQUIRE(ezy::accumulate(v, 0, std::minus{}) == -15);
   REQUIRE(ezy::accumulate(v, 1, std::multiplies{}) == 120);
+
+  int init = 5;
+  static_assert(std::is_same_v<decltype(ezy::accumulate(v, init)), int>);
+  REQUIRE(ezy::accumulate(v, init) == 20);
+  REQUIRE(ezy::accumulate(v, init, std::minus{}) == -10);
+  REQUIRE(init == 5);
 }
 
 SCENARIO("accumulate works with member function")
@@ -1130,6 +1978,194 @@ SCENARIO("repeat")
   REQUIRE(joined == "4,4,4,4,4");
 }
 
+SCENARIO("cycle over random access ranges")
+{
+  GIVEN("a vector")
+  {
+    const std::vector<int> v{1, 2, 3};
+    const auto cycled = ezy::cycle(v);
+    using iterator_category = typename std::iterator_traits<decltype(cycled.begin())>::iterator_category;
+    static_assert(std::is_same_v<iterator_category, std::random_access_iterator_tag>);
+
+    THEN("it can be indexed")
+    {
+      REQUIRE(cycled[0] == 1);
+      REQUIRE(cycled[4] == 2);
+      REQUIRE(cycled[3'000'000'002] == 3);
+      REQUIRE(*(cycled.begin() + 7) == 2);
+      REQUIRE(*(cycled.begin() + 7 - 5) == 3);
+    }
+
+    THEN("stepping back wraps around")
+    {
+      auto it = cycled.begin() + 1;
+      --it;
+      --it;
+      REQUIRE(*it == 3);
+      REQUIRE(*(it - 2) == 1);
+      REQUIRE(it[-4] == 2);
+    }
+
+    THEN("taking from it is sized")
+    {
+      const auto taken = ezy::take(cycled, 8);
+      REQUIRE(taken.size() == 8);
+      REQUIRE(join_as_strings(taken, ",") == "1,2,3,1,2,3,1,2");
+      REQUIRE(ezy::collect<std::vector<int>>(taken) == std::vector{1, 2, 3, 1, 2, 3, 1, 2});
+    }
+  }
+
+  GIVEN("an empty vector")
+  {
+    const auto cycled = ezy::cycle(std::vector<int>{});
+    REQUIRE(std::begin(cycled) == std::end(cycled));
+    REQUIRE(ezy::take(cycled, 5).size() == 0);
+  }
+}
+
+SCENARIO("repeat n times")
+{
+  GIVEN("a sized repetition")
+  {
+    const auto repeated = ezy::repeat(std::string("ab"), 3);
+    REQUIRE(repeated.size() == 3);
+    REQUIRE(repeated[2] == "ab");
+    REQUIRE(join_as_strings(repeated, ",") == "ab,ab,ab");
+    REQUIRE(ezy::collect<std::vector<std::string>>(repeated) == std::vector<std::string>(3, "ab"));
+  }
+
+  GIVEN("padding")
+  {
+    REQUIRE(ezy::collect<std::string>(ezy::repeat('-', 4)) == "----");
+    REQUIRE(ezy::collect<std::vector<char>>(ezy::repeat('\0', 0)).empty());
+  }
+
+  GIVEN("an infinite repetition")
+  {
+    const char c = 'x';
+    const auto taken = ezy::take(ezy::repeat(c), 3);
+    REQUIRE(taken.size() == 3);
+    REQUIRE(ezy::collect<std::string>(taken) == "xxx");
+  }
+}
+
+SCENARIO("cache_latest")
+{
+  const std::vector<int> v{3, 1, 4, 1, 5, 9, 2, 6};
+  int calls = 0;
+  const auto expensive = [&calls](int i) { ++calls; return std::to_string(i); };
+
+  GIVEN("a transformed range")
+  {
+    auto cached = ezy::cache_latest(ezy::transform(v, expensive));
+    using iterator_category = typename std::iterator_traits<decltype(cached.begin())>::iterator_category;
+    static_assert(std::is_same_v<iterator_category, std::input_iterator_tag>);
+    static_assert(!is_const_iterable<decltype(cached)>::value);
+
+    THEN("the current element is evaluated once")
+    {
+      auto it = cached.begin();
+      REQUIRE(*it == "3");
+      REQUIRE(it->size() == 1);
+      REQUIRE(*it == "3");
+      REQUIRE(calls == 1);
+      ++it;
+      REQUIRE(*it == "1");
+      REQUIRE(calls == 2);
+    }
+
+    THEN("filtering by iterators evaluates each element once")
+    {
+      auto filtered = ezy::filter(cached, [](const std::string& s) { return s > "3"; });
+      std::vector<std::string> result;
+      for (const auto& s : filtered)
+        result.push_back(s);
+      REQUIRE(result == std::vector<std::string>{"4", "5", "9", "6"});
+      REQUIRE(calls == 8);
+    }
+
+    THEN("it is sized")
+    {
+      REQUIRE(cached.size() == v.size());
+      REQUIRE(ezy::accumulate(cached, std::string{}) == "31415926");
+    }
+  }
+
+  GIVEN("an input range")
+  {
+    std::istringstream stream("1 2 3");
+    auto cached = ezy::cache_latest(ezy::detail::subrange_view<std::istream_iterator<int>>{std::istream_iterator<int>(stream), {}});
+    REQUIRE(ezy::accumulate(cached, 0) == 6);
+  }
+}
+
+SCENARIO("memoize_all")
+{
+  const std::vector<int> v{1, 2, 3, 4, 5};
+  int calls = 0;
+  const auto expensive = [&calls](int i) { ++calls; return i * 10; };
+
+  GIVEN("a transformed range")
+  {
+    const auto memoized = ezy::memoize_all(ezy::transform(v, expensive));
+
+    THEN("nothing is evaluated in advance")
+    {
+      REQUIRE(calls == 0);
+      REQUIRE(*memoized.begin() == 10);
+      REQUIRE(calls == 1);
+    }
+
+    THEN("later passes replay the elements")
+    {
+      REQUIRE(join_as_strings(memoized, ",") == "10,20,30,40,50");
+      REQUIRE(ezy::accumulate(memoized, 0) == 150);
+      REQUIRE(*std::max_element(memoized.begin(), memoized.end()) == 50);
+      REQUIRE(calls == 5);
+    }
+
+    THEN("a partial pass is continued")
+    {
+      REQUIRE(ezy::collect<std::vector<int>>(ezy::take(memoized, 2)) == std::vector{10, 20});
+      REQUIRE(calls == 2);
+      REQUIRE(ezy::collect<std::vector<int>>(memoized) == std::vector{10, 20, 30, 40, 50});
+      REQUIRE(calls == 5);
+    }
+
+    THEN("references stay valid while evaluating further")
+    {
+      const int& first = *memoized.begin();
+      REQUIRE(std::distance(memoized.begin(), memoized.end()) == 5);
+      REQUIRE(first == 10);
+    }
+
+    THEN("it is sized")
+    {
+      REQUIRE(memoized.size() == 5);
+    }
+  }
+
+  GIVEN("an empty range")
+  {
+    const auto memoized = ezy::memoize_all(std::vector<int>{});
+    REQUIRE(memoized.begin() == memoized.end());
+  }
+
+  GIVEN("an extended range")
+  {
+    const auto memoized = ezy::make_extended<ezy::features::iterable>(v).map(expensive).memoize_all();
+    REQUIRE(memoized.accumulate(0) == 150);
+    REQUIRE(memoized.accumulate(0) == 150);
+    REQUIRE(calls == 5);
+
+    auto cached = ezy::make_extended<ezy::features::iterable>(v).map(expensive).cache_latest();
+    int sum = 0;
+    for (int i : cached)
+      sum += i;
+    REQUIRE(sum == 150);
+  }
+}
+
 SCENARIO("chunk")
 {
   const std::vector<int> v{1,2,3,4,5,6,7,8,9};
@@ -1161,6 +2197,419 @@ SCENARIO("chunk works with array")
   REQUIRE(join_as_strings(ezy::flatten(chunks)) == "123456789");
 }
 
+SCENARIO("chunks of contiguous ranges")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8,9};
+
+  GIVEN("dynamic chunk size")
+  {
+    const auto chunks = ezy::chunk(v, 4);
+    static_assert(std::is_same_v<ezy::remove_cvref_t<decltype(*std::begin(chunks))>, ezy::detail::span_view<const int>>);
+
+    THEN("chunks are spans into the vector")
+    {
+      auto it = std::begin(chunks);
+      REQUIRE(it->data() == v.data());
+      REQUIRE(it->size() == 4);
+      REQUIRE(it[2].data() == v.data() + 8);
+      REQUIRE(it[2].size() == 1);
+      REQUIRE(std::end(chunks) - it == 3);
+    }
+
+    THEN("elements can be modified through mutable chunks")
+    {
+      auto mutable_chunks = ezy::chunk(v, 4);
+      for (auto chunk : mutable_chunks)
+        chunk[0] = 0;
+      REQUIRE(v == std::vector<int>{0,2,3,4,0,6,7,8,0});
+    }
+  }
+
+  GIVEN("static chunk size")
+  {
+    const auto chunks = ezy::chunk<4>(v);
+    static_assert(std::is_same_v<ezy::remove_cvref_t<decltype(*std::begin(chunks))>, ezy::detail::span_view<const int, 4>>);
+    static_assert(sizeof(*std::begin(chunks)) == sizeof(const int*));
+
+    THEN("only full chunks are visited")
+    {
+      REQUIRE(ezy::size(chunks) == 2);
+      REQUIRE(ezy::collect<std::vector<int>>(ezy::transform(chunks, [](const auto& chunk) { return ezy::accumulate(chunk, 0); })) == std::vector{10, 26});
+      REQUIRE(join_as_strings(chunks.remainder()) == "9");
+    }
+
+    THEN("a range shorter than a chunk has no chunks")
+    {
+      const auto short_chunks = ezy::chunk<16>(v);
+      REQUIRE(ezy::size(short_chunks) == 0);
+      REQUIRE(std::begin(short_chunks) == std::end(short_chunks));
+      REQUIRE(short_chunks.remainder().size() == 9);
+    }
+  }
+
+  GIVEN("an empty vector")
+  {
+    const std::vector<int> empty;
+    REQUIRE(ezy::size(ezy::chunk(empty, 4)) == 0);
+    REQUIRE(ezy::size(ezy::chunk<4>(empty)) == 0);
+  }
+}
+
+SCENARIO("windows")
+{
+  const auto sums = [](const auto& windows) {
+    return ezy::collect<std::vector<int>>(ezy::transform(windows, [](const auto& window) { return ezy::accumulate(window, 0); }));
+  };
+
+  GIVEN("a vector")
+  {
+    std::vector<int> v{1,2,3,4,5};
+    const auto windows = ezy::windows(v, 3);
+    static_assert(std::is_same_v<ezy::remove_cvref_t<decltype(*std::begin(windows))>, ezy::detail::span_view<const int>>);
+
+    REQUIRE(ezy::size(windows) == 3);
+    REQUIRE(sums(windows) == std::vector{6, 9, 12});
+    REQUIRE(std::begin(windows)[1].data() == v.data() + 1);
+    REQUIRE(ezy::size(ezy::windows(v, 5)) == 1);
+    REQUIRE(ezy::size(ezy::windows(v, 6)) == 0);
+    REQUIRE(std::begin(ezy::windows(v, 6)) == std::end(ezy::windows(v, 6)));
+  }
+
+  GIVEN("a vector with static window size")
+  {
+    const std::vector<int> v{1,2,3,4,5};
+    const auto windows = ezy::windows<2>(v);
+    static_assert(std::is_same_v<ezy::remove_cvref_t<decltype(*std::begin(windows))>, ezy::detail::span_view<const int, 2>>);
+
+    const auto differences = ezy::collect<std::vector<int>>(ezy::transform(windows, [](const auto& w) { return w[1] - w[0]; }));
+    REQUIRE(differences == std::vector{1, 1, 1, 1});
+  }
+
+  GIVEN("a list")
+  {
+    const std::list<int> l{1,2,3,4,5};
+    REQUIRE(sums(ezy::windows(l, 2)) == std::vector{3, 5, 7, 9});
+    REQUIRE(ezy::size(ezy::windows(l, 2)) == 4);
+    REQUIRE(sums(ezy::windows(l, 5)) == std::vector{15});
+    REQUIRE(sums(ezy::windows(l, 6)).empty());
+  }
+
+  GIVEN("an input range")
+  {
+    std::istringstream stream("1 2 3 4 5");
+    const auto input = ezy::detail::subrange_view<std::istream_iterator<int>>{std::istream_iterator<int>(stream), std::istream_iterator<int>()};
+    auto windows = ezy::windows(input, 3);
+    static_assert(!is_const_iterable<decltype(windows)>::value);
+    std::vector<std::string> result;
+    for (const auto& window : windows)
+      result.push_back(join_as_strings(window, ","));
+    REQUIRE(result == std::vector<std::string>{"1,2,3", "2,3,4", "3,4,5"});
+  }
+
+  GIVEN("an input range shorter than the window")
+  {
+    std::istringstream stream("1 2");
+    const auto input = ezy::detail::subrange_view<std::istream_iterator<int>>{std::istream_iterator<int>(stream), std::istream_iterator<int>()};
+    auto windows = ezy::windows(input, 3);
+    REQUIRE(std::begin(windows) == std::end(windows));
+  }
+
+  GIVEN("windows of size 0")
+  {
+    const std::vector<int> v{1, 2, 3};
+    REQUIRE(ezy::size(ezy::windows(v, 0)) == 0);
+    REQUIRE(sums(ezy::windows(v, 0)).empty());
+
+    const std::list<int> l{1, 2, 3};
+    REQUIRE(ezy::size(ezy::windows(l, 0)) == 0);
+    REQUIRE(sums(ezy::windows(l, 0)).empty());
+
+    std::istringstream stream("1 2 3");
+    const auto input = ezy::detail::subrange_view<std::istream_iterator<int>>{std::istream_iterator<int>(stream), std::istream_iterator<int>()};
+    auto windows = ezy::windows(input, 0);
+    REQUIRE(std::begin(windows) == std::end(windows));
+  }
+}
+
+SCENARIO("rolling")
+{
+  std::vector<int> v(200);
+  for (size_t i = 0; i < v.size(); ++i)
+    v[i] = static_cast<int>((i * 7919) % 101) - 50;
+
+  const auto naive_rolling = [&v](size_t window_size, auto op) {
+    std::vector<int> result;
+    for (size_t i = 0; i + window_size <= v.size(); ++i)
+      result.push_back(std::accumulate(v.begin() + i + 1, v.begin() + i + window_size, v[i], op));
+    return result;
+  };
+
+  for (size_t window_size : {1u, 2u, 7u, 60u, 200u})
+  {
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, window_size, std::plus<>{})) == naive_rolling(window_size, std::plus<>{}));
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, window_size, ezy::min)) == naive_rolling(window_size, ezy::min));
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, window_size, ezy::max)) == naive_rolling(window_size, ezy::max));
+
+    const auto bit_or = [](int a, int b) { return a | b; };
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, window_size, bit_or)) == naive_rolling(window_size, bit_or));
+
+    const auto xor_op = ezy::invertible(std::bit_xor<>{}, std::bit_xor<>{});
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, window_size, xor_op)) == naive_rolling(window_size, std::bit_xor<>{}));
+  }
+
+  GIVEN("a range shorter than the window")
+  {
+    const auto rolled = ezy::rolling(v, 201, std::plus<>{});
+    REQUIRE(ezy::size(rolled) == 0);
+    REQUIRE(std::begin(rolled) == std::end(rolled));
+  }
+
+  GIVEN("windows of size 0")
+  {
+    REQUIRE(ezy::size(ezy::rolling(v, 0, std::plus<>{})) == 0);
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, 0, ezy::min)).empty());
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(v, 0, [](int a, int b) { return a | b; })).empty());
+    REQUIRE(ezy::collect<std::vector<double>>(ezy::rolling_mean(v, 0)).empty());
+  }
+
+  GIVEN("a list")
+  {
+    const std::list<int> l{3, 1, 4, 1, 5, 9, 2, 6};
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(l, 3, ezy::max)) == std::vector{4, 4, 5, 9, 9, 9});
+    REQUIRE(ezy::collect<std::vector<int>>(ezy::rolling(l, 3, ezy::min)) == std::vector{1, 1, 1, 1, 2, 2});
+  }
+
+  GIVEN("moving average")
+  {
+    const std::vector<int> values{1, 2, 3, 4, 5};
+    REQUIRE(ezy::collect<std::vector<double>>(ezy::rolling_mean(values, 2)) == std::vector{1.5, 2.5, 3.5, 4.5});
+  }
+}
+
+SCENARIO("views with sentinel")
+{
+  std::vector<int> v{1,2,3,4,5,6,7,8,9,10};
+
+  GIVEN("nested views")
+  {
+    const auto pipeline = ezy::take_while(ezy::drop(ezy::step_by(v, 2), 1), [](int i) { return i < 9; });
+    static_assert(std::is_same_v<decltype(pipeline.sentinel()), ezy::detail::end_marker_t>);
+
+    THEN("iterating with the sentinel gives the same elements")
+    {
+      std::string result;
+      for (const auto e : ezy::with_sentinel(pipeline))
+        result += std::to_string(e);
+      REQUIRE(result == "357");
+      REQUIRE(join_as_strings(pipeline) == "357");
+    }
+
+    THEN("ezy algorithms use it")
+    {
+      REQUIRE(ezy::accumulate(pipeline, 0) == 15);
+      REQUIRE(ezy::all_of(pipeline, [](int i) { return i % 2 == 1; }));
+      REQUIRE(ezy::any_of(pipeline, [](int i) { return i == 5; }));
+      REQUIRE(ezy::none_of(pipeline, [](int i) { return i == 9; }));
+    }
+
+    THEN("the end iterator still works for iterator pairs")
+    {
+      REQUIRE(std::vector<int>(pipeline.begin(), pipeline.end()) == std::vector{3,5,7});
+    }
+  }
+
+  GIVEN("chunks")
+  {
+    const auto chunks = ezy::chunk(v, 4);
+    auto it = std::begin(chunks);
+    REQUIRE(it != chunks.sentinel());
+    ++it; ++it;
+    REQUIRE(it != chunks.sentinel());
+    ++it;
+    REQUIRE(it == chunks.sentinel());
+  }
+
+  GIVEN("a concatenated range")
+  {
+    const auto concatenated = ezy::concatenate(v, std::vector{11, 12});
+    REQUIRE(ezy::accumulate(concatenated, 0) == 78);
+    REQUIRE(std::distance(concatenated.begin(), concatenated.end()) == 12);
+  }
+
+  GIVEN("a cycled range")
+  {
+    const auto cycled = ezy::cycle(std::vector{1, 2});
+    REQUIRE(std::begin(cycled) != cycled.sentinel());
+    REQUIRE(join_as_strings(ezy::take_while(ezy::take(cycled, 5), [](int) { return true; })) == "12121");
+  }
+}
+
+SCENARIO("internal iteration of segmented views")
+{
+  const std::vector<std::vector<int>> nested{{1, 2}, {}, {3}, {4, 5, 6}};
+
+  GIVEN("a flattened range")
+  {
+    const auto flattened = ezy::flatten(nested);
+    REQUIRE(ezy::accumulate(flattened, 0) == 21);
+    REQUIRE(ezy::all_of(flattened, [](int i) { return i > 0; }));
+    REQUIRE(ezy::collect<std::vector>(flattened) == std::vector{1, 2, 3, 4, 5, 6});
+
+    std::vector<int> out;
+    ezy::collect(flattened, std::back_inserter(out));
+    REQUIRE(out == std::vector{1, 2, 3, 4, 5, 6});
+  }
+
+  GIVEN("a mutable flattened range")
+  {
+    std::vector<std::vector<int>> mutable_nested{{1}, {2, 3}};
+    auto flattened = ezy::flatten(mutable_nested);
+    ezy::for_each(flattened, [](int& i) { i *= 2; });
+    REQUIRE(mutable_nested == std::vector<std::vector<int>>{{2}, {4, 6}});
+  }
+
+  GIVEN("a concatenated range")
+  {
+    const std::vector<int> v{1, 2, 3};
+    const std::list<int> l{4, 5};
+    const auto concatenated = ezy::concatenate(v, l, ezy::flatten(nested));
+    REQUIRE(ezy::accumulate(concatenated, 0) == 36);
+
+    WHEN("the iteration stops early")
+    {
+      int calls = 0;
+      REQUIRE(ezy::any_of(concatenated, [&](int i) { ++calls; return i == 4; }));
+      REQUIRE(calls == 4);
+
+      calls = 0;
+      REQUIRE_FALSE(ezy::all_of(concatenated, [&](int i) { ++calls; return i < 5; }));
+      REQUIRE(calls == 5);
+    }
+  }
+
+  GIVEN("a transformed and filtered segmented range")
+  {
+    const auto odds = ezy::filter(ezy::flatten(nested), [](int i) { return i % 2 == 1; });
+    REQUIRE(ezy::accumulate(ezy::transform(odds, [](int i) { return i * 10; }), 0) == 90);
+    REQUIRE(ezy::none_of(odds, [](int i) { return i == 2; }));
+  }
+}
+
+SCENARIO("reduce")
+{
+  std::vector<long> v(1000);
+  std::iota(v.begin(), v.end(), 1);
+
+  GIVEN("in order reduction")
+  {
+    REQUIRE(ezy::reduce(v, 0L) == 500500);
+    REQUIRE(ezy::reduce(std::list<int>{1, 2, 3}, 0, std::multiplies<>{}) == 0);
+    REQUIRE(ezy::reduce(std::list<int>{1, 2, 3}, 1, std::multiplies<>{}) == 6);
+  }
+
+  GIVEN("reassociated reduction of contiguous ranges")
+  {
+    REQUIRE(ezy::reduce(v, 0L, ezy::reassociate) == 500500);
+    REQUIRE(ezy::reduce(v, 10L, ezy::reassociate) == 500510);
+    REQUIRE(ezy::reduce(ezy::slice(v, 10, 20), 0L, ezy::reassociate) == 155);
+    REQUIRE(ezy::reduce(ezy::take(v, 3), 0L, ezy::reassociate) == 6);
+    REQUIRE(ezy::reduce(ezy::drop(v, 997), 0L, ezy::reassociate) == 2997);
+    REQUIRE(ezy::reduce(std::vector<int>{}, 5, ezy::reassociate) == 5);
+    REQUIRE(ezy::reduce(v, 0L, ezy::max, ezy::reassociate) == 1000);
+  }
+
+  GIVEN("small elements")
+  {
+    const std::vector<signed char> chars(300, 100);
+    REQUIRE(ezy::reduce(chars, 0, ezy::reassociate) == 30000);
+  }
+
+  GIVEN("a non contiguous range")
+  {
+    REQUIRE(ezy::reduce(std::list<int>{1, 2, 3}, 0, ezy::reassociate) == 6);
+  }
+}
+
+SCENARIO("min_element and max_element")
+{
+  GIVEN("a vector")
+  {
+    std::vector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+    v[42] = -5;
+    v[77] = -5;
+    v[13] = 500;
+    v[90] = 500;
+
+    REQUIRE(ezy::min_element(v) == v.begin() + 42);
+    REQUIRE(ezy::max_element(v) == v.begin() + 13);
+    const auto second_half = ezy::slice(v, 50, 100);
+    REQUIRE(ezy::min_element(second_half) == v.begin() + 77);
+    REQUIRE(ezy::max_element(v, std::greater<>{}) == std::max_element(v.begin(), v.end(), std::greater<>{}));
+  }
+
+  GIVEN("floating point numbers with NaN")
+  {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> v(40, 1.0);
+    v[3] = nan;
+    v[20] = 0.5;
+    REQUIRE(ezy::min_element(v) == std::min_element(v.begin(), v.end()));
+    v[0] = nan;
+    REQUIRE(ezy::min_element(v) == std::min_element(v.begin(), v.end()));
+  }
+
+  GIVEN("an empty range")
+  {
+    const std::vector<float> empty;
+    REQUIRE(ezy::min_element(empty) == empty.end());
+  }
+
+  GIVEN("a list")
+  {
+    const std::list<int> l{3, 1, 2};
+    REQUIRE(*ezy::min_element(l) == 1);
+    REQUIRE(*ezy::max_element(l) == 3);
+  }
+}
+
+SCENARIO("minmax")
+{
+  GIVEN("a contiguous range")
+  {
+    std::vector<float> v(100);
+    std::iota(v.begin(), v.end(), -50.f);
+    const auto result = ezy::minmax(v);
+    REQUIRE(result.has_value());
+    REQUIRE(result->first == -50.f);
+    REQUIRE(result->second == 49.f);
+  }
+
+  GIVEN("a list")
+  {
+    const auto result = ezy::minmax(std::list<int>{4, 2, 8, 6});
+    REQUIRE(result.has_value());
+    REQUIRE(*result == std::pair(2, 8));
+  }
+
+  GIVEN("an empty range")
+  {
+    REQUIRE_FALSE(ezy::minmax(std::vector<int>{}).has_value());
+    REQUIRE_FALSE(ezy::minmax(std::list<int>{}).has_value());
+  }
+}
+
+SCENARIO("count_if")
+{
+  std::vector<int> v(100);
+  std::iota(v.begin(), v.end(), 0);
+  const auto is_even = [](int i) { return i % 2 == 0; };
+  REQUIRE(ezy::count_if(v, is_even) == 50);
+  REQUIRE(ezy::count_if(ezy::take(v, 5), is_even) == 3);
+  REQUIRE(ezy::count_if(ezy::filter(v, is_even), is_even) == 50);
+  REQUIRE(ezy::count_if(std::list<int>{1, 2, 3}, is_even) == 1);
+}
+
 SCENARIO("range(until)")
 {
   GIVEN("a range until 0")
@@ -1244,6 +2693,70 @@ SCENARIO("range(from, until, step)")
     const auto r = ezy::range(2, -17, -3);
     REQUIRE(join_as_strings(r, ",") == "2,-1,-4,-7,-10,-13,-16");
   }
+
+  GIVEN("steps near the limits of the type")
+  {
+    constexpr int max = std::numeric_limits<int>::max();
+    constexpr int min = std::numeric_limits<int>::min();
+
+    const auto large_steps = ezy::range(5, max, 1 << 28);
+    REQUIRE(ezy::size(large_steps) == 8);
+    REQUIRE(std::begin(large_steps)[7] == 5 + 7 * (1 << 28));
+
+    const auto whole = ezy::range(-2'000'000'000, 2'000'000'000);
+    REQUIRE(ezy::size(whole) == 4'000'000'000u);
+    REQUIRE(std::begin(whole)[3'999'999'999] == 1'999'999'999);
+
+    REQUIRE(ezy::size(ezy::range(min, max)) == 4'294'967'295u);
+    REQUIRE(join_as_strings(ezy::range(max, min, min), ",") == "2147483647,-1");
+    REQUIRE(join_as_strings(ezy::range(max - 2, max, 5), ",") == "2147483645");
+    REQUIRE(ezy::empty(ezy::range(min, max, -1)));
+    REQUIRE(ezy::size(ezy::range(std::uint8_t{0}, std::uint8_t{255}, std::uint8_t{100})) == 3);
+  }
+}
+
+SCENARIO("range is a random access, sized view")
+{
+  GIVEN("range(until)")
+  {
+    const auto r = ezy::range(10);
+    static_assert(std::is_same_v<ezy::detail::iterator_category_t<decltype(r)>, std::random_access_iterator_tag>);
+    REQUIRE(ezy::size(r) == 10);
+    REQUIRE(std::begin(r)[7] == 7);
+    REQUIRE(*(std::begin(r) + 3) == 3);
+    REQUIRE(std::end(r) - std::begin(r) == 10);
+  }
+
+  GIVEN("range(from, until, step)")
+  {
+    const auto r = ezy::range(2, 15, 3);
+    REQUIRE(ezy::size(r) == 5);
+    REQUIRE(std::begin(r)[4] == 14);
+    REQUIRE(ezy::size(ezy::range(2, 14, 3)) == 4);
+    REQUIRE(ezy::size(ezy::range(15, 2, 3)) == 0);
+    REQUIRE(ezy::size(ezy::range(2, 15, -3)) == 0);
+  }
+
+  GIVEN("unsigned bounds")
+  {
+    REQUIRE(ezy::size(ezy::range(5u, 2u)) == 0);
+    REQUIRE(join_as_strings(ezy::range(2u, 5u), ",") == "2,3,4");
+  }
+
+  GIVEN("floating point step")
+  {
+    REQUIRE(ezy::size(ezy::range(0.0, 1.0, 0.25)) == 4);
+    REQUIRE(ezy::size(ezy::range(0.0, 1.1, 0.25)) == 5);
+  }
+
+  GIVEN("enumerate")
+  {
+    const std::vector<char> v{'a', 'b', 'c'};
+    const auto enumerated = ezy::enumerate(v);
+    REQUIRE(ezy::size(enumerated) == 3);
+    REQUIRE(std::get<0>(*std::next(std::begin(enumerated), 2)) == 2);
+    REQUIRE(std::get<1>(*std::next(std::begin(enumerated), 2)) == 'c');
+  }
 }
 
 SCENARIO("split")
@@ -1276,3 +2789,139 @@ SCENARIO("split")
     REQUIRE(ezy::join(r, "+") == "This+is+a+sentence.");
   }
 }
+
+namespace
+{
+  std::vector<std::string> naive_split(const std::string& in, std::string_view delimiters)
+  {
+    std::vector<std::string> result;
+    std::string current;
+    for (const char c : in)
+    {
+      if (delimiters.find(c) != std::string_view::npos)
+      {
+        if (!current.empty())
+          result.push_back(std::move(current));
+        current.clear();
+      }
+      else
+        current += c;
+    }
+    if (!current.empty())
+      result.push_back(std::move(current));
+    return result;
+  }
+
+  std::string generated_input(size_t length, std::string_view alphabet)
+  {
+    std::string result;
+    size_t state = length;
+    for (size_t i = 0; i < length; ++i)
+    {
+      state = state * 6364136223846793005u + 1442695040888963407u;
+      result += alphabet[(state >> 33) % alphabet.size()];
+    }
+    return result;
+  }
+}
+
+SCENARIO("split by a set of delimiters")
+{
+  GIVEN("a line with whitespaces")
+  {
+    const std::string in("a b\tc\r\n  d");
+    const auto r = ezy::split(in, ezy::char_set(" \t\r\n"));
+    REQUIRE(ezy::join(r, "+") == "a+b+c+d");
+  }
+
+  GIVEN("a large set of delimiters")
+  {
+    const std::string in("a,b;c.d:e!f?g-h=i");
+    const auto r = ezy::split(in, ezy::char_set(",;.:!?-="));
+    REQUIRE(ezy::join(r, "") == "abcdefghi");
+
+    const auto r2 = ezy::split(in, ezy::char_set(",;.:!?-=/"));
+    REQUIRE(ezy::join(r2, "") == "abcdefghi");
+  }
+
+  GIVEN("a non-contiguous range")
+  {
+    const std::list<char> in{'a', ' ', 'b', '\t', 'c'};
+    const auto r = ezy::split(in, ezy::char_set(" \t"));
+    const auto to_string = [](const auto& part) { return part.template to<std::string>(); };
+    REQUIRE(ezy::join(ezy::transform(r, to_string), "+") == "a+b+c");
+  }
+
+  GIVEN("bytes")
+  {
+    const std::vector<std::byte> in{std::byte{1}, std::byte{0}, std::byte{2}, std::byte{3}};
+    const auto r = ezy::split(in, std::byte{0});
+    const auto sizes = ezy::collect<std::vector<size_t>>(ezy::transform(r, [](const auto& part) { return part.size(); }));
+    REQUIRE(sizes == std::vector<size_t>{1, 2});
+  }
+}
+
+SCENARIO("split matches a naive implementation")
+{
+  for (const auto alphabet : {std::string_view("ab "), std::string_view("abcdefghijklmnopqrstuvwxyz, \n")})
+  {
+    for (size_t length : {0u, 1u, 15u, 16u, 17u, 31u, 33u, 100u, 1000u})
+    {
+      const auto in = generated_input(length, alphabet);
+      REQUIRE(ezy::collect<std::vector<std::string>>(ezy::split(in, ' ')) == naive_split(in, " "));
+      REQUIRE(ezy::collect<std::vector<std::string>>(ezy::split(in, ezy::char_set(" ,\n"))) == naive_split(in, " ,\n"));
+    }
+  }
+}
+
+SCENARIO("split does not copy the parts")
+{
+  GIVEN("a string")
+  {
+    const std::string in("a bb ccc");
+    const auto r = ezy::split(in, ' ');
+    static_assert(std::is_same_v<ezy::remove_cvref_t<decltype(*std::begin(r))>, std::string_view>);
+
+    THEN("parts are views into the string")
+    {
+      auto it = std::begin(r);
+      REQUIRE(*it == "a");
+      REQUIRE(it->data() == in.data());
+      ++it;
+      REQUIRE(*it == "bb");
+      REQUIRE(it->data() == in.data() + 2);
+    }
+
+    THEN("parts can be copied into owning strings")
+    {
+      const auto owned = ezy::collect<std::vector<std::string>>(r);
+      REQUIRE(owned == std::vector<std::string>{"a", "bb", "ccc"});
+    }
+  }
+
+  GIVEN("a string_view")
+  {
+    const std::string_view in("a,b,,c");
+    const auto r = ezy::split(in, ',');
+    REQUIRE(ezy::join(r, "+") == "a+b+c");
+  }
+
+  GIVEN("a non-contiguous range")
+  {
+    const std::list<char> in{'a', ' ', 'b', 'c'};
+    const auto r = ezy::split(in, ' ');
+    auto it = std::begin(r);
+    REQUIRE(it->to<std::string>() == "a");
+    ++it;
+    REQUIRE(it->begin() == std::next(in.begin(), 2));
+    REQUIRE((*it).to<std::string>() == "bc");
+  }
+
+  GIVEN("a vector of numbers")
+  {
+    const std::vector<int> in{1, 2, 0, 3, 0, 0, 4, 5, 6};
+    const auto r = ezy::split(in, 0);
+    const auto sizes = ezy::collect<std::vector<size_t>>(ezy::transform(r, [](const auto& part) { return part.size(); }));
+    REQUIRE(sizes == std::vector<size_t>{2, 1, 3});
+  }
+}
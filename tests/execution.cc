@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+
+#include <ezy/algorithm.h>
+#include <ezy/algorithm/parallel.h>
+#include <ezy/math.h>
+
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+SCENARIO("parallel algorithms")
+{
+  std::vector<long> v(100'000);
+  std::iota(v.begin(), v.end(), 0);
+  const auto par = ezy::par.with_chunk_size(1000);
+
+  GIVEN("for_each")
+  {
+    std::atomic<long> sum{0};
+    ezy::for_each(par, v, [&sum](long i) { sum += i; });
+    REQUIRE(sum == 4'999'950'000);
+
+    std::vector<long> copy(v);
+    ezy::for_each(par, copy, [](long& i) { i *= 2; });
+    REQUIRE(copy[99'999] == 199'998);
+  }
+
+  GIVEN("accumulate and reduce")
+  {
+    REQUIRE(ezy::accumulate(par, v, 0L) == 4'999'950'000);
+    REQUIRE(ezy::reduce(par, v, 10L) == 4'999'950'010);
+    REQUIRE(ezy::reduce(ezy::par, v, 0L) == 4'999'950'000);
+    REQUIRE(ezy::reduce(ezy::par_unseq, v, 0L, ezy::max) == 99'999);
+    REQUIRE(ezy::reduce(ezy::seq, v, 0L) == 4'999'950'000);
+    REQUIRE(ezy::reduce(par, std::vector<long>{}, 5L) == 5);
+  }
+
+  GIVEN("a map-filter chain")
+  {
+    const auto evens = ezy::filter(ezy::transform(v, [](long i) { return i * 3; }), [](long i) { return i % 2 == 0; });
+    REQUIRE(ezy::accumulate(par, evens, 0L) == ezy::accumulate(evens, 0L));
+    REQUIRE(ezy::collect<std::vector<long>>(par, evens) == ezy::collect<std::vector<long>>(evens));
+  }
+
+  GIVEN("zip and slice")
+  {
+    const auto pairs = ezy::zip_with(std::multiplies<>{}, v, v);
+    REQUIRE(ezy::accumulate(par, pairs, 0L) == ezy::accumulate(pairs, 0L));
+    REQUIRE(ezy::accumulate(par, ezy::slice(v, 100, 200), 0L) == 14'950);
+  }
+
+  GIVEN("short-circuiting algorithms")
+  {
+    REQUIRE(ezy::any_of(par, v, [](long i) { return i == 12'345; }));
+    REQUIRE_FALSE(ezy::any_of(par, v, [](long i) { return i < 0; }));
+    REQUIRE(ezy::all_of(par, v, [](long i) { return i >= 0; }));
+    REQUIRE(ezy::none_of(par, v, [](long i) { return i > 100'000; }));
+    REQUIRE(ezy::contains(par, v, 99'999L));
+    REQUIRE_FALSE(ezy::contains(par, v, -1L));
+
+    WHEN("an element is found early")
+    {
+      std::atomic<long> calls{0};
+      REQUIRE(ezy::any_of(par, v, [&calls](long i) { ++calls; return i == 10; }));
+      REQUIRE(calls < 100'000);
+    }
+  }
+
+  GIVEN("find_element_if")
+  {
+    REQUIRE(ezy::find_element_if(par, v, [](long i) { return i % 5000 == 4999; }) == v.begin() + 4999);
+    REQUIRE(ezy::find_element_if(par, v, [](long i) { return i < 0; }) == v.end());
+  }
+
+  GIVEN("collect")
+  {
+    REQUIRE(ezy::collect<std::vector>(par, v) == v);
+
+    const auto evens = ezy::collect<std::vector<long>>(par, ezy::filter(v, [](long i) { return i % 2 == 0; }));
+    REQUIRE(evens.size() == 50'000);
+    REQUIRE(evens.capacity() == evens.size());
+    REQUIRE(ezy::collect<std::string>(par, ezy::transform(v, [](long i) { return static_cast<char>('a' + i % 26); })).substr(0, 3) == "abc");
+  }
+
+  GIVEN("a range which cannot be partitioned")
+  {
+    const std::list<long> l(v.begin(), v.end());
+    REQUIRE(ezy::accumulate(par, l, 0L) == 4'999'950'000);
+    REQUIRE(ezy::any_of(par, l, [](long i) { return i == 10; }));
+  }
+
+  GIVEN("views with mutable functions")
+  {
+    const auto filtered = ezy::filter(v, [calls = 0](long i) mutable { ++calls; return i % 2 == 0; });
+    REQUIRE(ezy::reduce(par, filtered, 0L) == 2'499'950'000);
+
+    const auto doubled = ezy::transform(v, [calls = 0](long i) mutable { ++calls; return i * 2; });
+    REQUIRE(ezy::reduce(par, doubled, 0L) == 9'999'900'000);
+  }
+
+  GIVEN("views caching their begin")
+  {
+    const auto from_half = [](long i) { return i < 50'000; };
+    std::atomic<long> sum{0};
+    ezy::for_each(par, ezy::drop_while_sorted(v, from_half), [&sum](long i) { sum += i; });
+    REQUIRE(sum == 3'749'975'000);
+
+    REQUIRE(ezy::reduce(par, ezy::drop_while_sorted(v, from_half), 0L) == 3'749'975'000);
+    REQUIRE(ezy::any_of(par, ezy::drop_while_sorted(v, from_half), [](long i) { return i == 99'999; }));
+    REQUIRE(ezy::collect<std::vector<long>>(par, ezy::drop(v, 99'990)).size() == 10);
+
+    auto dropped = ezy::drop_while_sorted(v, from_half);
+    REQUIRE(*ezy::find_element_if(par, dropped, [](long i) { return i % 1000 == 999; }) == 50'999);
+  }
+
+  GIVEN("an exception")
+  {
+    REQUIRE_THROWS_AS(ezy::for_each(par, v, [](long i) { if (i == 50'000) throw std::runtime_error("error"); }), std::runtime_error);
+  }
+}
@@ -267,8 +267,33 @@ SCENARIO("strong type extensions")
         COMPARE_RANGES(result, (std::array{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 3, 4, 5, 6, 7, 8}));
       }
     }
+    WHEN("more ranges concatenated at once")
+    {
+      const std::vector<int> others{3, 4, 5};
+      const std::vector<int> more_others{6, 7, 8};
+      const auto result = numbers.concatenate(others, more_others);
+
+      THEN("contains all elements")
+      {
+        COMPARE_RANGES(result, (std::array{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 3, 4, 5, 6, 7, 8}));
+      }
+    }
 
 
+    WHEN("reductions called")
+    {
+      THEN("it is OK")
+      {
+        REQUIRE(numbers.reduce(0) == 55);
+        REQUIRE(numbers.reduce(0, ezy::reassociate) == 55);
+        REQUIRE(numbers.reduce(1, std::multiplies<>{}, ezy::reassociate) == 3628800);
+        REQUIRE(*numbers.min_element() == 1);
+        REQUIRE(*numbers.max_element() == 10);
+        REQUIRE(*numbers.minmax() == std::pair(1, 10));
+        REQUIRE(numbers.count_if(ezy::less_than(4)) == 3);
+      }
+    }
+
     WHEN("all() called")
     {
       THEN("it is OK")
@@ -545,6 +570,10 @@ SCENARIO("strong type extensions")
       REQUIRE(MyNumbers{}.accumulate(10) == 10);
       REQUIRE(numbers.accumulate(0) == 55);
       REQUIRE(numbers.accumulate(0, std::minus<int>{}) == -55);
+
+      int init = 5;
+      REQUIRE(numbers.accumulate(init) == 60);
+      REQUIRE(numbers.accumulate(init, std::minus<int>{}) == -50);
     }
 
     /*
@@ -790,6 +819,49 @@ SCENARIO("strong type extensions")
       }
     }
 
+    WHEN("chunked by a static size")
+    {
+      const auto result = numbers.chunk<3>();
+      THEN("it splitted into 3 full chunks")
+      {
+        REQUIRE(ezy::size(result) == 3);
+        COMPARE_RANGES(*(std::next(std::begin(result),2)), (std::array<int, 3>{7,8,9}));
+      }
+    }
+
+    WHEN("windowed")
+    {
+      const auto result = numbers.windows(9).map([](const auto& window) { return ezy::accumulate(window, 0); });
+      THEN("it contains the sums of two windows")
+      {
+        COMPARE_RANGES(result, (std::array<int, 2>{45, 54}));
+      }
+    }
+
+    WHEN("windowed by a static size")
+    {
+      const auto result = numbers.windows<2>().map([](const auto& window) { return window[0] * window[1]; });
+      THEN("it contains the products of neighbours")
+      {
+        REQUIRE(ezy::size(result) == 9);
+        COMPARE_RANGES(result.take(3), (std::array<int, 3>{2, 6, 12}));
+      }
+    }
+
+    WHEN("rolled")
+    {
+      THEN("it contains the moving minimums")
+      {
+        const auto result = MyNumbers{5, 3, 4, 8, 1, 7}.rolling(3, ezy::min);
+        COMPARE_RANGES(result, (std::array<int, 4>{3, 3, 1, 1}));
+      }
+
+      THEN("it contains the moving averages")
+      {
+        COMPARE_RANGES(numbers.rolling_mean(4).take(2), (std::array<double, 2>{2.5, 3.5}));
+      }
+    }
+
     WHEN("mutating chunked")
     {
       auto my_numbers = MyNumbers{1,2,3,4,5,6,7};
@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+
+#include <ezy/mapped_file.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace
+{
+  struct temporary_file
+  {
+    explicit temporary_file(const std::string& content)
+    {
+      char name[] = "/tmp/ezy_mapped_file_XXXXXX";
+      const int fd = ::mkstemp(name);
+      REQUIRE(fd != -1);
+      ::close(fd);
+      path = name;
+      std::ofstream(path, std::ios::binary) << content;
+    }
+
+    ~temporary_file()
+    {
+      std::remove(path.c_str());
+    }
+
+    std::string path;
+  };
+}
+
+SCENARIO("mapped_file")
+{
+  GIVEN("a file")
+  {
+    temporary_file file("first\nsecond\n\nfourth");
+    const ezy::mapped_file mapped(file.path);
+
+    THEN("it is a contiguous range of its content")
+    {
+      REQUIRE(mapped.size() == 20);
+      REQUIRE(mapped.view() == "first\nsecond\n\nfourth");
+      REQUIRE(std::string(mapped.begin(), mapped.end()) == "first\nsecond\n\nfourth");
+    }
+
+    THEN("its lines can be iterated")
+    {
+      REQUIRE(mapped.lines().to<std::vector<std::string>>() == std::vector<std::string>{"first", "second", "", "fourth"});
+    }
+
+    THEN("lines can be processed by a pipeline")
+    {
+      const auto lengths = mapped.lines()
+        .filter([](std::string_view line) { return !line.empty(); })
+        .map([](std::string_view line) { return line.size(); })
+        .to<std::vector<size_t>>();
+      REQUIRE(lengths == std::vector<size_t>{5, 6, 6});
+    }
+
+    THEN("lines refer to the mapped memory")
+    {
+      const auto lines = mapped.lines();
+      REQUIRE(std::begin(lines)->data() == mapped.data());
+    }
+
+    THEN("it can be viewed as records")
+    {
+      REQUIRE(mapped.records(6).to<std::vector<std::string>>() == std::vector<std::string>{"first\n", "second", "\n\nfour"});
+      REQUIRE(ezy::size(ezy::records(mapped, 6)) == 3);
+    }
+  }
+
+  GIVEN("a temporary mapped file")
+  {
+    temporary_file file("a\nb\n");
+    const auto lines = ezy::mapped_file(file.path).lines().map([](std::string_view line) { return std::string(line) + "!"; });
+    REQUIRE(ezy::join(lines, ",") == "a!,b!");
+  }
+
+  GIVEN("an empty file")
+  {
+    temporary_file file("");
+    const ezy::mapped_file mapped(file.path);
+    REQUIRE(mapped.empty());
+    REQUIRE(mapped.lines().to<std::vector<std::string>>().empty());
+  }
+
+  GIVEN("a file which does not exist")
+  {
+    REQUIRE_THROWS_AS(ezy::mapped_file("/nonexistent/ezy/file"), std::system_error);
+  }
+}
+
+SCENARIO("lines")
+{
+  const auto to_vector = [](auto&& range) { return ezy::collect<std::vector<std::string>>(range); };
+
+  REQUIRE(to_vector(ezy::lines(std::string(""))).empty());
+  REQUIRE(to_vector(ezy::lines(std::string_view())).empty());
+  REQUIRE(to_vector(ezy::lines(std::string("\n"))) == std::vector<std::string>{""});
+  REQUIRE(to_vector(ezy::lines(std::string("a"))) == std::vector<std::string>{"a"});
+  REQUIRE(to_vector(ezy::lines(std::string("a\n"))) == std::vector<std::string>{"a"});
+  REQUIRE(to_vector(ezy::lines(std::string("a\n\nb"))) == std::vector<std::string>{"a", "", "b"});
+}
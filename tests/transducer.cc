@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+
+#include <ezy/transducer.h>
+#include <ezy/algorithm/iterate.h>
+#include <ezy/algorithm/transform.h>
+#include <ezy/pipe.h>
+
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const auto push_back = [](std::vector<int> acc, int i)
+  {
+    acc.push_back(i);
+    return acc;
+  };
+}
+
+SCENARIO("transduce")
+{
+  const std::vector<int> v{1, 2, 2, 3, 3, 3, 4, 5, 6, 7, 8};
+
+  GIVEN("a single stage")
+  {
+    REQUIRE(ezy::transduce(v, ezy::xf::map([](int i) { return i * 10; }), std::plus<>{}, 0) == 440);
+    REQUIRE(ezy::transduce(v, ezy::xf::filter([](int i) { return i % 2 == 0; }), push_back, std::vector<int>{}) == std::vector{2, 2, 4, 6, 8});
+    REQUIRE(ezy::transduce(v, ezy::xf::dedupe(), push_back, std::vector<int>{}) == std::vector{1, 2, 3, 4, 5, 6, 7, 8});
+    REQUIRE(ezy::transduce(v, ezy::xf::drop(8), push_back, std::vector<int>{}) == std::vector{6, 7, 8});
+    REQUIRE(ezy::transduce(v, ezy::xf::take_while([](int i) { return i < 4; }), std::plus<>{}, 0) == 14);
+  }
+
+  GIVEN("a stage with a mutable function")
+  {
+    const auto numbered = ezy::xf::map([n = 0](int i) mutable { return i * 100 + ++n; });
+    REQUIRE(ezy::transduce(v, ezy::pipe(numbered, ezy::xf::take(3)), push_back, std::vector<int>{}) == std::vector{101, 202, 203});
+  }
+
+  GIVEN("stages composed by pipe")
+  {
+    const auto xf = ezy::pipe(
+        ezy::xf::dedupe(),
+        ezy::xf::map([](int i) { return i * 2; }),
+        ezy::xf::filter([](int i) { return i > 4; }),
+        ezy::xf::take(3));
+
+    REQUIRE(ezy::transduce(v, xf, push_back, std::vector<int>{}) == std::vector{6, 8, 10});
+
+    THEN("pipes can be nested")
+    {
+      const auto nested = ezy::pipe(xf, ezy::xf::map([](int i) { return i + 1; }));
+      REQUIRE(ezy::transduce(v, nested, push_back, std::vector<int>{}) == std::vector{7, 9, 11});
+    }
+
+    THEN("the same stack runs over other ranges")
+    {
+      const std::list<int> l{3, 3, 1, 4, 5};
+      REQUIRE(ezy::transduce(l, xf, push_back, std::vector<int>{}) == std::vector{6, 8, 10});
+      REQUIRE(ezy::transduce(ezy::transform(l, [](int i) { return i + 1; }), xf, push_back, std::vector<int>{}) == std::vector{8, 10, 12});
+    }
+  }
+
+  GIVEN("chunks")
+  {
+    const auto sum_of_chunks = [](std::vector<int> acc, const std::vector<int>& chunk)
+    {
+      int sum = 0;
+      for (const int i : chunk)
+        sum += i;
+      acc.push_back(sum);
+      return acc;
+    };
+
+    THEN("the last chunk may be shorter")
+    {
+      REQUIRE(ezy::transduce(v, ezy::xf::chunk(4), sum_of_chunks, std::vector<int>{}) == std::vector{8, 15, 21});
+    }
+
+    THEN("chunks of a taken prefix")
+    {
+      const auto xf = ezy::pipe(ezy::xf::take(5), ezy::xf::chunk(2));
+      REQUIRE(ezy::transduce(v, xf, sum_of_chunks, std::vector<int>{}) == std::vector{3, 5, 3});
+    }
+
+    THEN("taking chunks")
+    {
+      const auto xf = ezy::pipe(ezy::xf::chunk(3), ezy::xf::take(2));
+      REQUIRE(ezy::transduce(v, xf, sum_of_chunks, std::vector<int>{}) == std::vector{5, 9});
+    }
+  }
+
+  GIVEN("an infinite range")
+  {
+    int pulled = 0;
+    const auto counted = ezy::transform(ezy::iterate(0), [&pulled](int i) { ++pulled; return i; });
+    const auto xf = ezy::pipe(ezy::xf::filter([](int i) { return i % 3 == 0; }), ezy::xf::take(4));
+    REQUIRE(ezy::transduce(counted, xf, push_back, std::vector<int>{}) == std::vector{0, 3, 6, 9});
+    REQUIRE(pulled == 10);
+  }
+}
+
+SCENARIO("transducer sink")
+{
+  GIVEN("a sink with early termination")
+  {
+    const auto xf = ezy::pipe(ezy::xf::filter([](int i) { return i >= 0; }), ezy::xf::take(3));
+    auto sink = ezy::make_transducer_sink<int>(xf, push_back, std::vector<int>{});
+
+    WHEN("elements are pushed by a producer")
+    {
+      int produced = 0;
+      for (int i : {5, -1, 6, 7, 8, 9})
+      {
+        ++produced;
+        if (!sink(i))
+          break;
+      }
+
+      THEN("the producer is stopped")
+      {
+        REQUIRE(produced == 4);
+        REQUIRE(sink.is_done());
+        REQUIRE_FALSE(sink(10));
+        REQUIRE(std::move(sink).complete() == std::vector{5, 6, 7});
+      }
+    }
+  }
+
+  GIVEN("a sink holding a partial chunk")
+  {
+    const auto joined = [](std::string acc, const std::vector<char>& chunk)
+    {
+      acc.append(chunk.begin(), chunk.end());
+      acc.push_back('|');
+      return acc;
+    };
+    auto sink = ezy::make_transducer_sink<char>(ezy::pipe(ezy::xf::dedupe(), ezy::xf::chunk(2)), joined, std::string{});
+
+    for (const char c : std::string("aabbcdde"))
+      REQUIRE(sink(c));
+
+    REQUIRE(sink.get() == "ab|cd|");
+    REQUIRE(std::move(sink).complete() == "ab|cd|e|");
+  }
+}